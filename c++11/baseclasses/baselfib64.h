@@ -130,11 +130,11 @@ SOFTWARE.
 *   should definitively pass.
 */
 template<const std::uint32_t SIZE, const std::uint32_t K>
-class BaseLFib64 : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>
+class BaseLFib64 : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, BaseLFib64<SIZE, K>>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, BaseLFib64<SIZE, K>>;
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
     using value_type  = typename state_type::value_type;
@@ -159,7 +159,7 @@ public:
     virtual inline ~BaseLFib64() noexcept = default;                //!< default destructor.
 
     //---   Internal PRNG   -------------------------------------------------
-    virtual const output_type next() noexcept override;             //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final;            //!< The internal PRNG algorithm.
 
     inline void _initIndex(const size_t _index) noexcept;           //!< Inits the internal index pointing to the internal list.
 
@@ -114,12 +114,12 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-class BaseMELG : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t>
+template<const std::uint32_t SIZE, typename EngineT = void>
+class BaseMELG : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>;
 
     using output_type = typename MyBaseClass::output_type;
     using state_type  = typename MyBaseClass::state_type;
@@ -165,8 +165,8 @@ public:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG() noexcept
     : MyBaseClass()
 {
     seed();
@@ -174,8 +174,8 @@ inline BaseMELG<SIZE>::BaseMELG() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (int). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -183,8 +183,8 @@ inline BaseMELG<SIZE>::BaseMELG(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned int). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -192,8 +192,8 @@ inline BaseMELG<SIZE>::BaseMELG(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -201,8 +201,8 @@ inline BaseMELG<SIZE>::BaseMELG(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -210,8 +210,8 @@ inline BaseMELG<SIZE>::BaseMELG(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -219,8 +219,8 @@ inline BaseMELG<SIZE>::BaseMELG(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -228,8 +228,8 @@ inline BaseMELG<SIZE>::BaseMELG(const unsigned long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (utils::UInt128). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -237,8 +237,8 @@ inline BaseMELG<SIZE>::BaseMELG(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (double). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -246,8 +246,8 @@ inline BaseMELG<SIZE>::BaseMELG(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -255,88 +255,88 @@ inline BaseMELG<SIZE>::BaseMELG(const state_type& internal_state) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed() noexcept
 {
     MyBaseClass::seed();
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-*bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::_setstate(const utils::UInt128& seed) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::_setstate(const utils::UInt128& seed) noexcept
 {
     MyBaseClass::_setstate(seed);
 }
@@ -120,11 +120,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-struct BaseMRG31 : public BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31>
+template<const std::uint32_t SIZE, typename EngineT = void>
+struct BaseMRG31 : public BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31, EngineT>
 {
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31, EngineT>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -172,8 +172,8 @@ struct BaseMRG31 : public BaseRandom<ListSeedState<utils::SplitMix31, std::uint3
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31() noexcept
     : MyBaseClass()
 {
     seed();
@@ -181,8 +181,8 @@ inline BaseMRG31<SIZE>::BaseMRG31() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -190,8 +190,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -199,8 +199,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -208,8 +208,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -217,8 +217,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -226,8 +226,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -235,8 +235,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -244,8 +244,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (double). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -253,8 +253,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -262,88 +262,88 @@ inline BaseMRG31<SIZE>::BaseMRG31(const state_type& internal_state) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed() noexcept
 {
     _setstate(utils::set_random_seed31());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::_setstate(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
 }
@@ -103,11 +103,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-struct BaseMRG32 : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32>
+template<const std::uint32_t SIZE, typename EngineT = void>
+struct BaseMRG32 : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32, EngineT>
 {
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32, EngineT>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -155,8 +155,8 @@ struct BaseMRG32 : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint3
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32() noexcept
     : MyBaseClass()
 {
     seed();
@@ -164,8 +164,8 @@ inline BaseMRG32<SIZE>::BaseMRG32() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -173,8 +173,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -182,8 +182,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -191,8 +191,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -200,8 +200,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -209,8 +209,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -218,8 +218,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -227,8 +227,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (double). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -236,8 +236,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -245,88 +245,88 @@ inline BaseMRG32<SIZE>::BaseMRG32(const state_type& internal_state) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed() noexcept
 {
     _setstate(utils::set_random_seed32());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::_setstate(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
 }
@@ -134,7 +134,7 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-template<typename StateT, typename OutputT>
-using BasePCG = BaseRandom<StateT, OutputT, 8 * sizeof(OutputT)>;
+template<typename StateT, typename OutputT, typename EngineT = void>
+using BasePCG = BaseRandom<StateT, OutputT, 8 * sizeof(OutputT), EngineT>;
 
 /** @}*/
@@ -117,6 +117,16 @@ SOFTWARE.
 *   periods),  64-bits precision calculations and short memory consumption  (resp.  4,
 *   8 and 16 integers each coded on 64 bits.
 *
+*   Template argument EngineT is the final PRNG class that inherits from this class,
+*   as in the Curiously Recurring Template Pattern (CRTP). When it is set, every call
+*   to next() that is internal to this base class - i.e. by random(), uniform(),  the
+*   distributions functions,  shuffle(),  and so on - is statically dispatched to the
+*   final implementation EngineT::next(),  which may then get inlined. When it is let
+*   to its default value void, the internal calls to next() are dispatched  at  run-
+*   time through the virtual table, as they were before. Virtual method next() is in
+*   all cases still available for the users that need runtime polymorphism. All the
+*   PRNGs that are implemented in CppRandLib set EngineT to their own class.
+*
 *   Furthermore this class and all its inheriting sub-classes are callable. Example:
 * @code
 *     BaseRandom rand{}; // CAUTION: Replace 'BaseRandom' with any inheriting class constructor!
@@ -349,7 +359,8 @@ SOFTWARE.
 template<
     typename StateT,
     typename OutputT = std::uint32_t,
-    const std::uint8_t OUTPUT_BITS = 8 * sizeof(OutputT)
+    const std::uint8_t OUTPUT_BITS = 8 * sizeof(OutputT),
+    typename EngineT = void
 >
 class BaseRandom
 {
@@ -413,13 +424,13 @@ public:
         if (!std::is_floating_point<T>::value)
             throw FloatingPointTypeException();
 
-        return T(double(next()) * _NORMALIZE);
+        return T(double(_next()) * _NORMALIZE);
     }
 
     template<>
     inline const long double random()
     {
-        return (long double)next() * _NORMALIZE_LD;
+        return (long double)_next() * _NORMALIZE_LD;
     }
 
 
@@ -529,7 +540,7 @@ public:
             throw TooMuchReturnedBitsException<OutputT>();
 
         const unsigned int rot{ OUTPUT_BITS - k };
-        const OutputT n{ next() };
+        const OutputT n{ _next() };
         const OutputT ret{ n >> rot };
         return ret;
     }
@@ -981,6 +992,30 @@ protected:
     static constexpr double _NORMALIZE{ double(_NORMALIZE_LD)};
 
 
+    //---   Internal PRNG   -------------------------------------------------
+    using _EngineType = typename std::conditional<std::is_void<EngineT>::value, BaseRandom, EngineT>::type;
+
+    /** @brief Statically dispatched call to the internal PRNG algorithm.
+    *
+    * Calls EngineT::next() without any virtual call when template argument
+    * EngineT is set, or the virtual method next() otherwise.
+    */
+    inline const output_type _next() noexcept
+    {
+        return _next(std::is_void<EngineT>());
+    }
+
+    inline const output_type _next(std::true_type) noexcept
+    {
+        return next();
+    }
+
+    inline const output_type _next(std::false_type) noexcept
+    {
+        return static_cast<_EngineType*>(this)->_EngineType::next();
+    }
+
+
     //---   Operations   ----------------------------------------------------
     /** @brief Sets the internal state with an integer seed.
     *
@@ -1001,39 +1036,39 @@ protected:
 //===========================================================================
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::BPF{ 53 };  // Number of bits in a float
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::BPF{ 53 };  // Number of bits in a float
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::E{ std::exp(1.0) };
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::E{ std::exp(1.0) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::GAUSS_NULL = -1.0;
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::GAUSS_NULL = -1.0;
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::LOG4{ std::log(4.0) };
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::LOG4{ std::log(4.0) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::NV_MAGICCONST{ 4 * std::exp(-0.5) / std::sqrt(2.0) };
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::NV_MAGICCONST{ 4 * std::exp(-0.5) / std::sqrt(2.0) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::PI{ 3.14159265358979323846 };
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::PI{ 3.14159265358979323846 };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::RECIP_BPF{ std::exp2(-BPF) };
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::RECIP_BPF{ std::exp2(-BPF) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::SG_MAGICCONST{ 1.0 + std::log(4.5) };
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::SG_MAGICCONST{ 1.0 + std::log(4.5) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::TWO_PI{ 2.0 * BaseRandom<StateT, OutputT, OUTPUT_BITS>::PI };
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::TWO_PI{ 2.0 * BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::PI };
 
 
 //---------------------------------------------------------------------------
 /** Valued call operator (1 scalar). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T max)
+const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const T max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ArithmeticValueTypeException();
@@ -1043,9 +1078,9 @@ const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T max)
 
 //---------------------------------------------------------------------------
 /** Valued call operator (max and n scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T max, const std::size_t n)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const T max, const std::size_t n)
 {
     if (!std::is_arithmetic<T>::value)
         throw ArithmeticValueTypeException();
@@ -1060,9 +1095,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T max
 
 //---------------------------------------------------------------------------
 /** Valued call operator (min, max and n scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T min, const T max, const std::size_t n)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const T min, const T max, const std::size_t n)
 {
     if (!std::is_arithmetic<T>::value)
         throw ArithmeticValueTypeException();
@@ -1077,9 +1112,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T min
 
 //---------------------------------------------------------------------------
 /** Valued call operator (1 std::vector of scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::vector<T>& max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const std::vector<T>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw MaxValueTypeException();
@@ -1093,9 +1128,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::
 
 //---------------------------------------------------------------------------
 /** Valued call operator (1 std::array of scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t n>
-std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::array<T, n>& max)
+std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const std::array<T, n>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw MaxValueTypeException();
@@ -1111,9 +1146,9 @@ std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std
 
 //---------------------------------------------------------------------------
 /** Valued call operator (2 std::vector of scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::vector<T>& min, const std::vector<T>& max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const std::vector<T>& min, const std::vector<T>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw MaxValueTypeException();
@@ -1129,9 +1164,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::
 
 //---------------------------------------------------------------------------
 /** Valued call operator (2 std::array of scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t n>
-std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::array<T, n>& min, const std::array<T, n>& max)
+std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const std::array<T, n>& min, const std::array<T, n>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw MaxValueTypeException();
@@ -1148,9 +1183,9 @@ std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std
 
 //---------------------------------------------------------------------------
 /** Returns the number of successes for n>=0 independent trials. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename CountT, typename ProbaT>
-const CountT BaseRandom<StateT, OutputT, OUTPUT_BITS>::binomialvariate(CountT n, const ProbaT p)
+const CountT BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::binomialvariate(CountT n, const ProbaT p)
 {
     if (!std::is_integral<CountT>::value)
         throw IntegralValueTypeException();
@@ -1173,9 +1208,9 @@ const CountT BaseRandom<StateT, OutputT, OUTPUT_BITS>::binomialvariate(CountT n,
 
 //---------------------------------------------------------------------------
 /** Chooses a random element from a non-empty sequence (std::vector). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-const T& BaseRandom<StateT, OutputT, OUTPUT_BITS>::choice(const std::vector<T>& seq)
+const T& BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choice(const std::vector<T>& seq)
 {
     const std::size_t n{ seq.size() };
     if (n == 0)
@@ -1185,9 +1220,9 @@ const T& BaseRandom<StateT, OutputT, OUTPUT_BITS>::choice(const std::vector<T>&
 
 //---------------------------------------------------------------------------
 /** Chooses a random element from a non-empty sequence (std::array). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t n>
-const T& BaseRandom<StateT, OutputT, OUTPUT_BITS>::choice(const std::array<T, n>& seq)
+const T& BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choice(const std::array<T, n>& seq)
 {
     if (n == 0)
         throw ChoiceEmptySequenceException();
@@ -1196,9 +1231,9 @@ const T& BaseRandom<StateT, OutputT, OUTPUT_BITS>::choice(const std::array<T, n>
 
 //---------------------------------------------------------------------------
 /** Returns a k sized vector of elements chosen from the population with replacement (same weights). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choices(
     const std::vector<T>& population,
     const std::size_t k
 )
@@ -1214,9 +1249,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
 
 //---------------------------------------------------------------------------
 /** Returns a k sized vector of elements chosen from the population with replacement (individual weights). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename C>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choices(
     const std::vector<T>& population,
     std::vector<C>& weights,
     const std::size_t k
@@ -1236,9 +1271,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
 
 //---------------------------------------------------------------------------
 /** Returns a k sized vector of elements chosen from the population with replacement (cumulative weights). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename C>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices_cum(
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choices_cum(
     const std::vector<T>& population,
     const std::vector<C>& cum_weights,
     const std::size_t k
@@ -1269,9 +1304,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices_cum(
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values that are uniformly contained within range [0.0, 1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-inline std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::size_t n)
+inline std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::size_t n)
 {
     if (!std::is_floating_point<T>::value)
         throw FloatingPointTypeException();
@@ -1281,9 +1316,9 @@ inline std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values that are uniformly contained within range [0, max). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename U>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::size_t n, const U max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::size_t n, const U max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1301,9 +1336,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::s
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values in range [0; max[i]). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename U>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::vector<U>& max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::vector<U>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1323,9 +1358,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::v
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values in range [min[i]; max[i]). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename U, typename V>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::vector<U>& min, const std::vector<V>& max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::vector<U>& min, const std::vector<V>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1348,9 +1383,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::v
 
 //---------------------------------------------------------------------------
 /** Returns an array of n values that are uniformly contained within range [0.0, 1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t n>
-inline std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate()
+inline std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate()
 {
     if (!std::is_floating_point<T>::value)
         throw FloatingPointTypeException();
@@ -1365,9 +1400,9 @@ inline std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate()
 
 //---------------------------------------------------------------------------
 /** Returns an array of n values that are uniformly contained within range [0, max). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t n, typename U>
-std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const U max)
+std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const U max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1384,9 +1419,9 @@ std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const U ma
 
 //---------------------------------------------------------------------------
 /** Returns an array of n values that are uniformly contained within range [min, max). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t n, typename U, typename V>
-std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const U min, const V max)
+std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const U min, const V max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1405,9 +1440,9 @@ std::array<T, n> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const U mi
 
 //---------------------------------------------------------------------------
 /** Returns an array of min(m, n) values in range [0; max[i]). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t m, typename U, const std::size_t n>
-std::array<T, m> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::array<U, n>& max)
+std::array<T, m> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::array<U, n>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1430,13 +1465,13 @@ std::array<T, m> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std:
 
 //---------------------------------------------------------------------------
 /** Returns an array min(m, n, p) values in range [min[i]; max[i]). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<
     typename T, const std::size_t m,
     typename U, const std::size_t n,
     typename V, const std::size_t p
 >
-std::array<T, m> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::array<U, n>& min, const std::array<V, p>& max)
+std::array<T, m> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::array<U, n>& min, const std::array<V, p>& max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1462,8 +1497,8 @@ std::array<T, m> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std:
 
 //---------------------------------------------------------------------------
 /** Generates n random bytes. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline std::vector<std::uint8_t> BaseRandom<StateT, OutputT, OUTPUT_BITS>::randbytes(const std::size_t n)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline std::vector<std::uint8_t> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::randbytes(const std::size_t n)
 {
     if (n == 0)
         throw ZeroLengthException();
@@ -1476,9 +1511,9 @@ inline std::vector<std::uint8_t> BaseRandom<StateT, OutputT, OUTPUT_BITS>::randb
 
 //---------------------------------------------------------------------------
 /** Returns a random integer in range [a, b], including both end points. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randint(const T a, const T b)
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::randint(const T a, const T b)
 {
     if (!std::is_integral<T>::value)
         throw IntegralValueTypeException();
@@ -1491,9 +1526,9 @@ inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randint(const T a, cons
 
 //---------------------------------------------------------------------------
 /** Returns a random value in range [start, stop) with specified step. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename S>
-const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randrange(const T start, const T stop, const S step)
+const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::randrange(const T start, const T stop, const S step)
 {
     if (!std::is_arithmetic<T>::value)
         throw ValueTypeException();
@@ -1520,9 +1555,9 @@ const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randrange(const T start, const
 
 //---------------------------------------------------------------------------
 /** Chooses k unique random elements from a population sequence (out std::vector, in container, default count per element = 1). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::sample(
     std::vector<T>& out,
     const std::vector<T>& population,
     const std::size_t k
@@ -1547,9 +1582,9 @@ void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
 
 //---------------------------------------------------------------------------
 /** Chooses k unique random elements from a population sequence (out std::array<>, in std::array<>, default count per element = 1). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, const std::size_t k, const std::size_t n>
-void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::sample(
     std::array<T, k>& out,
     const std::array<T, n>& population
 )
@@ -1570,9 +1605,9 @@ void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
 
 //---------------------------------------------------------------------------
 /** Chooses k unique random elements from a population sequence (std::vector<>, with counts vector). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename C>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::sample(
     std::vector<T>& out,
     const std::vector<T>& population,
     const std::vector<C>& counts,
@@ -1609,9 +1644,9 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
 
 //---------------------------------------------------------------------------
 /** Chooses k unique random elements from a population sequence (std::array<>, with counts array). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename C, const std::size_t k, const std::size_t n>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::sample(
     std::array<T, k>& out,
     const std::array<T, n>& population,
     const std::array<C, n>& counts
@@ -1643,40 +1678,40 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed() noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed() noexcept
 {
     seed(utils::set_random_seed64());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits signed integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const int seed_) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const int seed_) noexcept
 {
     seed((const long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits unsigned integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned int seed_) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const unsigned int seed_) noexcept
 {
     seed((const unsigned long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits signed integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const long seed_) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const long seed_) noexcept
 {
     seed((const unsigned long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits unsigned integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long seed_) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const unsigned long seed_) noexcept
 {
     _setstate(seed_);
     _internal_state.gauss_valid = false;
@@ -1684,16 +1719,16 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long s
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 64-bits signed integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const long long seed_) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const long long seed_) noexcept
 {
     seed((const unsigned long long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 64-bits unsigned integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long long seed_) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     _setstate(seed_);
     _internal_state.gauss_valid = false;
@@ -1701,8 +1736,8 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long l
 
 //---------------------------------------------------------------------------
 /** Initializes the internal state of this PRNG with a 128-bits integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const utils::UInt128& seed_) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     _setstate(seed_);
     _internal_state.gauss_valid = false;
@@ -1710,8 +1745,8 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const utils::UInt128&
 
 //---------------------------------------------------------------------------
 /** Initalizes internal state from a double seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const double seed_)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const double seed_)
 {
     if (0.0 <= seed_ && seed_ <= 1.0)
         seed(std::uint64_t(seed_ * double(0xffff'ffff'ffff'ffffULL)));
@@ -1721,16 +1756,16 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Restores internal state from object returned by getstate(). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const struct _InternalState& new_internal_state) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::setstate(const struct _InternalState& new_internal_state) noexcept
 {
     _internal_state = new_internal_state;
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state from a new internal state content. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new_internal_state) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::setstate(const StateT& new_internal_state) noexcept
 {
     _internal_state.state = new_internal_state;
     _internal_state.gauss_next = 0.0;
@@ -1739,8 +1774,8 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new
 
 //---------------------------------------------------------------------------
 /** Sets the internal state from a new internal state content and with gauss_next. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new_internal_state, const double gauss_next) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::setstate(const StateT& new_internal_state, const double gauss_next) noexcept
 {
     _internal_state.state = new_internal_state;
     _internal_state.gauss_next = gauss_next;
@@ -1749,17 +1784,17 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new
 
 //---------------------------------------------------------------------------
 /** Returns the current internal state value. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline const StateT BaseRandom<StateT, OutputT, OUTPUT_BITS>::state() const noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline const StateT BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::state() const noexcept
 {
     return _internal_state.state;
 }
 
 //---------------------------------------------------------------------------
 /** Shuffles specified sequence in place. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename ContainerType>
-void BaseRandom<StateT, OutputT, OUTPUT_BITS>::shuffle(ContainerType& seq)
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::shuffle(ContainerType& seq)
 {
     if (!utils::is_indexable<ContainerType>::value)
         throw IndexableContainerException();
@@ -1776,8 +1811,8 @@ void BaseRandom<StateT, OutputT, OUTPUT_BITS>::shuffle(ContainerType& seq)
 
 //---------------------------------------------------------------------------
 /** Beta distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::betavariate(const double alpha, const double beta)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::betavariate(const double alpha, const double beta)
 {
     if (alpha <= 0.0 || beta <= 0.0)
         throw AlphaBetaArgsException(alpha, beta);
@@ -1788,8 +1823,8 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::betavariate(const double
 
 //---------------------------------------------------------------------------
 /** Exponential distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::expovariate(const double lambda)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::expovariate(const double lambda)
 {
     if (lambda <= 0.0)
         throw ExponentialZeroLambdaException();
@@ -1803,8 +1838,8 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::expovariate(const double
 
 //---------------------------------------------------------------------------
 /** Gamma distribution. This is NOT the gamma function! */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gammavariate(const double alpha, const double beta)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gammavariate(const double alpha, const double beta)
 {
     constexpr int N_MAX_LOOPS{ 10 };
     int n_loops{ 0 };
@@ -1871,16 +1906,16 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gammavariate(const double
 
 //---------------------------------------------------------------------------
 /** Default Gaussian distribution (mean=0.0, stdev=1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gauss() noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss() noexcept
 {
     return gauss(0.0, 1.0);
 }
 
 //---------------------------------------------------------------------------
 /** Gaussian distribution (mean=mu, stdev=sigma). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gauss(const double mu, const double sigma)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss(const double mu, const double sigma)
 {
     if (sigma <= 0.0)
         throw GaussSigmaException(sigma);
@@ -1903,32 +1938,32 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gauss(const double mu, co
 
 //---------------------------------------------------------------------------
 /** Default Log normal distribution (mean=0.0, stdev=1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::lognormvariate()
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::lognormvariate()
 {
     return lognormvariate(0.0, 1.0);
 }
 
 //---------------------------------------------------------------------------
 /** Log normal distribution (mean=mu, stdev=sigma). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::lognormvariate(const double mu, const double sigma)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::lognormvariate(const double mu, const double sigma)
 {
     return std::exp(normalvariate(mu, sigma));
 }
 
 //---------------------------------------------------------------------------
 /** Normal distribution (mean=0.0, stdev=1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::normalvariate()
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::normalvariate()
 {
     return normalvariate(0.0, 1.0);
 }
 
 //---------------------------------------------------------------------------
 /** Normal distribution (mean=mu, stdev=sigma). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::normalvariate(const double mu, const double sigma)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::normalvariate(const double mu, const double sigma)
 {
     if (sigma <= 0.0)
         throw NormalSigmaException();
@@ -1952,8 +1987,8 @@ inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::normalvariate(cons
 
 //---------------------------------------------------------------------------
 /** Pareto distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::paretovariate(const double alpha)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::paretovariate(const double alpha)
 {
     if (alpha == 0.0)
         throw ParetoArgsValueException();
@@ -1964,24 +1999,24 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::paretovariate(const doubl
 
 //---------------------------------------------------------------------------
 /** Triangular distribution (low=0.0, high=1.0, mode=0.5). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular() noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::triangular() noexcept
 {
     return triangular(0.0, 1.0, 0.5);
 }
 
 //---------------------------------------------------------------------------
 /** Triangular distribution (low, high, default mode). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular(const double low, const double high) noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::triangular(const double low, const double high) noexcept
 {
     return triangular(low, high, (low + high) / 2.0);
 }
 
 //---------------------------------------------------------------------------
 /** Triangular distribution (low, high, mode). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular(const double low, const double high, const double mode)  noexcept
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::triangular(const double low, const double high, const double mode)  noexcept
 {
     if (high == low)
         return high;
@@ -1996,9 +2031,9 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular(const double l
 
 //---------------------------------------------------------------------------
 /** Uniform distribution in [0.0, 1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform()
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::uniform()
 {
     if (!std::is_floating_point<T>::value)
         throw FloatingPointTypeException();
@@ -2008,9 +2043,9 @@ inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform()
 
 //---------------------------------------------------------------------------
 /** Uniform distribution in [0.0, max). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename U>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform(const U max)
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::uniform(const U max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ArithmeticValueTypeException();
@@ -2026,9 +2061,9 @@ inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform(const U max)
 
 //---------------------------------------------------------------------------
 /** Uniform distribution in [min, max).*/
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
 template<typename T, typename U, typename V>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform(const U min, const V max)
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::uniform(const U min, const V max)
 {
     if (!std::is_arithmetic<T>::value)
         throw ArithmeticValueTypeException();
@@ -2047,8 +2082,8 @@ inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform(const U min, co
 
 //---------------------------------------------------------------------------
 /** Circular data distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::vonmisesvariate(const double mu, const double kappa)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::vonmisesvariate(const double mu, const double kappa)
 {
     // extracted from Python 3.11 comments:
     // Based upon an algorithm published in : Fisher, N.I.,
@@ -2097,8 +2132,8 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::vonmisesvariate(const dou
 
 //---------------------------------------------------------------------------
 /** Weibull distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::weibullvariate(const double alpha, const double beta)
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::weibullvariate(const double alpha, const double beta)
 {
     if (alpha < 0.0 || beta <= 0.0)
         throw WeibullArgsValueException();
@@ -105,12 +105,12 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-template<typename OutputT>
-class BaseSquares : public BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT)>
+template<typename OutputT, typename EngineT = void>
+class BaseSquares : public BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT), EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT)>;
+    using MyBaseClass = BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT), EngineT>;
     using output_type = OutputT;
     using state_type  = MyBaseClass::state_type;
     using value_type  = typename state_type::value_type;
@@ -155,8 +155,8 @@ public:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares() noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares() noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed();
@@ -164,8 +164,8 @@ inline BaseSquares<OutputT>::BaseSquares() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -173,8 +173,8 @@ inline BaseSquares<OutputT>::BaseSquares(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const unsigned int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -182,8 +182,8 @@ inline BaseSquares<OutputT>::BaseSquares(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -191,8 +191,8 @@ inline BaseSquares<OutputT>::BaseSquares(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const unsigned long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -200,8 +200,8 @@ inline BaseSquares<OutputT>::BaseSquares(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -209,8 +209,8 @@ inline BaseSquares<OutputT>::BaseSquares(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const unsigned long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -218,8 +218,8 @@ inline BaseSquares<OutputT>::BaseSquares(const unsigned long long seed_) noexcep
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned 128-bits). */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const utils::UInt128& seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -227,8 +227,8 @@ inline BaseSquares<OutputT>::BaseSquares(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const double seed_)
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -236,8 +236,8 @@ inline BaseSquares<OutputT>::BaseSquares(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const state_type& internal_state) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -245,80 +245,80 @@ inline BaseSquares<OutputT>::BaseSquares(const state_type& internal_state) noexc
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed() noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed() noexcept
 {
     _setstate(utils::set_random_seed64());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const unsigned int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const unsigned int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const unsigned long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const unsigned long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const long long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const unsigned long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const utils::UInt128& seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const double seed_)
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::_setstate(const std::uint64_t seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);  // notice: the std::uint64_t specialization of this method is automatically called here
     MyBaseClass::_internal_state.state.counter = 0;
@@ -326,8 +326,8 @@ inline void BaseSquares<OutputT>::_setstate(const std::uint64_t seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::_setstate(const utils::UInt128& seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
     MyBaseClass::_internal_state.state.counter = 0;
@@ -145,12 +145,12 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-template<const std::uint32_t SIZE>
-class BaseWell : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32>
+template<const std::uint32_t SIZE, typename EngineT = void>
+class BaseWell : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32, EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32, EngineT>;
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
     using value_type  = typename state_type::value_type;
@@ -223,8 +223,8 @@ protected:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell() noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed();
@@ -232,8 +232,8 @@ inline BaseWell<SIZE>::BaseWell() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (int). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -241,8 +241,8 @@ inline BaseWell<SIZE>::BaseWell(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor unsigned int). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -250,8 +250,8 @@ inline BaseWell<SIZE>::BaseWell(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -259,8 +259,8 @@ inline BaseWell<SIZE>::BaseWell(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -268,8 +268,8 @@ inline BaseWell<SIZE>::BaseWell(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long long). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -277,8 +277,8 @@ inline BaseWell<SIZE>::BaseWell(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -286,8 +286,8 @@ inline BaseWell<SIZE>::BaseWell(const unsigned long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (128-bits integer). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_.lo);
@@ -295,8 +295,8 @@ inline BaseWell<SIZE>::BaseWell(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (double). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -304,8 +304,8 @@ inline BaseWell<SIZE>::BaseWell(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseWell<SIZE>::BaseWell(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseWell<SIZE, EngineT>::BaseWell(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -313,72 +313,72 @@ inline BaseWell<SIZE>::BaseWell(const state_type& internal_state) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed() noexcept
 {
     MyBaseClass::seed();
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
@@ -386,23 +386,23 @@ inline void BaseWell<SIZE>::seed(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseWell<SIZE>::_setstate(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseWell<SIZE, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M0(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M0(
     const value_type x
 ) noexcept
 {
@@ -410,8 +410,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M0(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M1(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M1(
     const value_type x
 ) noexcept
 {
@@ -419,8 +419,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M1(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M2_pos(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M2_pos(
     const value_type x,
     const value_type t
 ) noexcept
@@ -429,8 +429,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M2_pos(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M2_neg(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M2_neg(
     const value_type x,
     const value_type t
 ) noexcept
@@ -439,8 +439,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M2_neg(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M3_pos(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M3_pos(
     const value_type x,
     const value_type t
 ) noexcept
@@ -449,8 +449,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M3_pos(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M3_neg(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M3_neg(
     const value_type x,
     const value_type t
 ) noexcept
@@ -459,8 +459,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M3_neg(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M4(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M4(
     const value_type x,
     const value_type a
 ) noexcept
@@ -469,8 +469,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M4(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M5_pos(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M5_pos(
     const value_type x,
     const value_type t,
     const value_type a
@@ -480,8 +480,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M5_pos(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M5_neg(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M5_neg(
     const value_type x,
     const value_type t,
     const value_type a
@@ -491,8 +491,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M5_neg(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M6(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_M6(
     const value_type x,
     const value_type q,
     const value_type t,
@@ -500,13 +500,13 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_M6(
     const value_type a
 ) noexcept
 {
-    value_type y{ (((x << q) & 0xffff'fffful) ^ (x >> (32 - q))) & BaseWell<SIZE>::_d(s) };
+    value_type y{ (((x << q) & 0xffff'fffful) ^ (x >> (32 - q))) & BaseWell<SIZE, EngineT>::_d(s) };
     return (x & (1 << t)) ? (y ^ a) : y;
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_d(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_d(
     const value_type s
 ) noexcept
 {
@@ -514,8 +514,8 @@ inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_d(
 }
 
 //---------------------------------------------------------------------------
-template<const std::uint32_t SIZE>
-inline typename BaseWell<SIZE>::value_type BaseWell<SIZE>::_tempering(
+template<const std::uint32_t SIZE, typename EngineT>
+inline typename BaseWell<SIZE, EngineT>::value_type BaseWell<SIZE, EngineT>::_tempering(
     const value_type x,
     const value_type b,
     const value_type c
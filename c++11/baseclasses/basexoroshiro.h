@@ -127,12 +127,12 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-class BaseXoroshiro : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>
+template<const std::uint32_t SIZE, typename EngineT = void>
+class BaseXoroshiro : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>;
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
     using value_type  = typename state_type::value_type;
@@ -177,8 +177,8 @@ public:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro() noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed();
@@ -186,8 +186,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -195,8 +195,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -204,8 +204,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -213,8 +213,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -222,8 +222,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -231,8 +231,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -240,8 +240,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long long seed_) noexce
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_.lo));
@@ -249,8 +249,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -258,8 +258,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -267,72 +267,72 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const state_type& internal_state) noex
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed() noexcept
 {
     MyBaseClass::seed();
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
@@ -340,16 +340,16 @@ inline void BaseXoroshiro<SIZE>::seed(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::_setstate(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
 }
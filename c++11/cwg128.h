@@ -103,11 +103,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Cwg128 : public BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128>
+class Cwg128 : public BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128, Cwg128>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128>;
+    using MyBaseClass = BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128, Cwg128>;
 
     using output_type = typename MyBaseClass::output_type;
     using state_type  = typename MyBaseClass::state_type;
@@ -132,7 +132,7 @@ public:
 
 
     //---   Internal PRNG   -------------------------------------------------
-    virtual const output_type next() noexcept override;                     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final;               //!< The internal PRNG algorithm.
 
 
     //---   Operations   ----------------------------------------------------
@@ -162,13 +162,13 @@ public:
         if (!std::is_floating_point<T>::value)
             throw FloatingPointTypeException();
 
-        return T(double(next()) * _NORMALIZE);
+        return T(double(_next()) * _NORMALIZE);
     }
 
     template<>
     inline const long double random() noexcept                              //!< specialization for long double.
     {
-        return (long double)next() * _NORMALIZE_LD;
+        return (long double)_next() * _NORMALIZE_LD;
     }
 
 };
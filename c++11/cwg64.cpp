@@ -87,19 +87,6 @@ Cwg64::Cwg64(const state_type& internal_state) noexcept
     : MyBaseClass(internal_state)
 {}
 
-//---------------------------------------------------------------------------
-/** The internal PRNG algorithm. */
-const Cwg64::output_type Cwg64::next() noexcept
-{
-    // evaluates next internal state
-    _internal_state.state.a    += _internal_state.state.state;
-    _internal_state.state.weyl += _internal_state.state.s;
-    _internal_state.state.state = ((_internal_state.state.state >> 1) * (_internal_state.state.a | 1)) ^ _internal_state.state.weyl;
-
-    // returns the xored - shifted output value
-    return _internal_state.state.state ^ (_internal_state.state.a >> 48);
-}
-
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
 void Cwg64::seed() noexcept
@@ -103,11 +103,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Cwg64 : public BaseCWG<std::uint64_t, std::uint64_t, std::uint64_t, 64>
+class Cwg64 : public BaseCWG<std::uint64_t, std::uint64_t, std::uint64_t, 64, Cwg64>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseCWG<std::uint64_t, std::uint64_t, std::uint64_t, 64>;
+    using MyBaseClass = BaseCWG<std::uint64_t, std::uint64_t, std::uint64_t, 64, Cwg64>;
 
     using output_type = typename MyBaseClass::output_type;
     using state_type  = typename MyBaseClass::state_type;
@@ -132,7 +132,7 @@ public:
 
 
     //---   Internal PRNG   -------------------------------------------------
-    virtual const output_type next() noexcept override;      //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
 
     //---   Operations   ----------------------------------------------------
@@ -149,4 +149,20 @@ public:
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm. */
+inline const Cwg64::output_type Cwg64::next() noexcept
+{
+    // evaluates next internal state
+    _internal_state.state.a    += _internal_state.state.state;
+    _internal_state.state.weyl += _internal_state.state.s;
+    _internal_state.state.state = ((_internal_state.state.state >> 1) * (_internal_state.state.a | 1)) ^ _internal_state.state.weyl;
+
+    // returns the xored - shifted output value
+    return _internal_state.state.state ^ (_internal_state.state.a >> 48);
+}
+
 /** @}*/
@@ -118,11 +118,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class FastRand32 : public BaseRandom<std::uint32_t, std::uint32_t, 32>
+class FastRand32 : public BaseRandom<std::uint32_t, std::uint32_t, 32, FastRand32>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<std::uint32_t, std::uint32_t, 32>;
+    using MyBaseClass = BaseRandom<std::uint32_t, std::uint32_t, 32, FastRand32>;
 
     //---   Constructors / Destructor   -------------------------------------
     inline FastRand32() noexcept;                                   //!< Empty constructor.
@@ -140,7 +140,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual inline const output_type next() noexcept override;      //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
     virtual inline void seed() noexcept override;                   //!< Initializes internal state (empty signature).
 
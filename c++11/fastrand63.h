@@ -102,7 +102,7 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class FastRand63 : public BaseRandom<std::uint64_t, std::uint64_t, 63>
+class FastRand63 : public BaseRandom<std::uint64_t, std::uint64_t, 63, FastRand63>
 {
 private:
     static const std::uint64_t _MODULO_63{ 0x7fff'ffff'ffff'ffffull };
@@ -110,7 +110,7 @@ private:
 
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<std::uint64_t, std::uint64_t, 63>;
+    using MyBaseClass = BaseRandom<std::uint64_t, std::uint64_t, 63, FastRand63>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -129,7 +129,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual inline const output_type next() noexcept override;      //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
     virtual inline void seed() noexcept override;                   //!< Initializes internal state (empty signature).
 
@@ -91,11 +91,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Melg19937 : public BaseMELG<312>
+class Melg19937 : public BaseMELG<312, Melg19937>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMELG<312>;
+    using MyBaseClass = BaseMELG<312, Melg19937>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -120,7 +120,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
     void seed() noexcept;                                   //!< Initializes internal state (empty signature).
 
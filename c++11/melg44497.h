@@ -90,11 +90,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Melg44497 : public BaseMELG<696>
+class Melg44497 : public BaseMELG<696, Melg44497>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMELG<696>;
+    using MyBaseClass = BaseMELG<696, Melg44497>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -119,7 +119,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
     void seed() noexcept;                                   //!< Initializes internal state (empty signature).
 
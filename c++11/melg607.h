@@ -91,11 +91,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Melg607 : public BaseMELG<10>
+class Melg607 : public BaseMELG<10, Melg607>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMELG<10>;
+    using MyBaseClass = BaseMELG<10, Melg607>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -120,7 +120,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
     void seed() noexcept;                                   //!< Initializes internal state (empty signature).
 
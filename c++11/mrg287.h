@@ -123,11 +123,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Mrg287 : public BaseMRG32<256>
+class Mrg287 : public BaseMRG32<256, Mrg287>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMRG32<256>;
+    using MyBaseClass = BaseMRG32<256, Mrg287>;
 
     using output_type = MyBaseClass::output_type;
     using state_type = MyBaseClass::state_type;
@@ -152,7 +152,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
         
 
 private:
@@ -106,11 +106,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Mrg49507 : public BaseMRG31<1597>
+class Mrg49507 : public BaseMRG31<1597, Mrg49507>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMRG31<1597>;
+    using MyBaseClass = BaseMRG31<1597, Mrg49507>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -131,7 +131,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
 
 private:
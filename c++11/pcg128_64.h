@@ -96,11 +96,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-class Pcg128_64 : public BasePCG<utils::UInt128, std::uint64_t>
+class Pcg128_64 : public BasePCG<utils::UInt128, std::uint64_t, Pcg128_64>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BasePCG<utils::UInt128, std::uint64_t>;
+    using MyBaseClass = BasePCG<utils::UInt128, std::uint64_t, Pcg128_64>;
     using value_type = utils::UInt128;
     // notice: output_type is defined in base class
 
@@ -119,7 +119,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
     virtual void seed() noexcept override;                  //!< Initializes internal state (empty signature).
 
@@ -104,20 +104,6 @@ Pcg64_32::Pcg64_32(const double seed_)
     seed(seed_);
 }
 
-//---------------------------------------------------------------------------
-/** The internal PRNG algorithm. */
-const Pcg64_32::output_type Pcg64_32::next() noexcept
-{
-    const value_type previous_state{ _internal_state.state };
-    const unsigned int random_shift{ previous_state >> 61 };  // random shift is set with the 3 upper bits of the internal state
-
-    // evaluates next state value
-    _internal_state.state = 0x5851'f42d'4c95'7f2dull * previous_state + 0x1405'7b7e'f767'814full;
-
-    // computes the permutated output
-    return Pcg64_32::output_type((previous_state ^ (previous_state >> 22)) >> (22 + random_shift));
-}
-
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
 inline void Pcg64_32::seed() noexcept
@@ -112,29 +112,3 @@ Squares32::Squares32(const state_type& internal_state) noexcept
 {
     MyBaseClass::setstate(internal_state);
 }
-
-//---------------------------------------------------------------------------
-/** The internal PRNG algorithm. */
-const Squares32::output_type Squares32::next() noexcept
-{
-    _internal_state.state.counter++;  // notice: modulo 2^64 increment
-
-    value_type x, y, z;
-    x = y = _internal_state.state.counter * _internal_state.state.key;
-    z = y + _internal_state.state.key;
-
-    // squaring - round 1
-    x = x * x + y;
-    x = (x >> 32) | (x << 32);
-
-    // squaring - round 2
-    x = x * x + z;
-    x = (x >> 32) | (x << 32);
-
-    // squaring - round 3
-    x = x * x + y;
-    x = (x >> 32) | (x << 32);
-
-    // squaring - round 4
-    return output_type((x * x + z) >> 32);
-}
@@ -87,11 +87,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-class Squares32 : public BaseSquares<std::uint32_t>
+class Squares32 : public BaseSquares<std::uint32_t, Squares32>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseSquares<std::uint32_t>;
+    using MyBaseClass = BaseSquares<std::uint32_t, Squares32>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -112,8 +112,37 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;      //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm. */
+inline const Squares32::output_type Squares32::next() noexcept
+{
+    _internal_state.state.counter++;  // notice: modulo 2^64 increment
+
+    value_type x, y, z;
+    x = y = _internal_state.state.counter * _internal_state.state.key;
+    z = y + _internal_state.state.key;
+
+    // squaring - round 1
+    x = x * x + y;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 2
+    x = x * x + z;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 3
+    x = x * x + y;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 4
+    return output_type((x * x + z) >> 32);
+}
+
 /** @}*/
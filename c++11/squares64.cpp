@@ -111,34 +111,3 @@ Squares64::Squares64(const state_type& internal_state) noexcept
 {
     MyBaseClass::setstate(internal_state);
 }
-
-//---------------------------------------------------------------------------
-/** The internal PRNG algorithm. */
-const Squares64::output_type Squares64::next() noexcept
-{
-    _internal_state.state.counter++;  // notice: modulo 2^64 increment
-
-    value_type x, y, z, t;
-
-    x = y = _internal_state.state.counter * _internal_state.state.key;
-    z = y + _internal_state.state.key;
-
-    // squaring - round 1
-    x = x * x + y;
-    x = (x >> 32) | (x << 32);
-
-    // squaring - round 2
-    x = x * x + z;
-    x = (x >> 32) | (x << 32);
-
-    // squaring - round 3
-    x = x * x + y;
-    x = (x >> 32) | (x << 32);
-
-    // squaring - round 4
-    t = x = x * x + z;
-    x = (x >> 32) | (x << 32);
-
-    // squaring - round 5
-    return t ^ ((x * x + y) >> 32);
-}
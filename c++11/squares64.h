@@ -87,11 +87,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-class Squares64 : public BaseSquares<std::uint64_t>
+class Squares64 : public BaseSquares<std::uint64_t, Squares64>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseSquares<std::uint64_t>;
+    using MyBaseClass = BaseSquares<std::uint64_t, Squares64>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -112,8 +112,42 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;      //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm. */
+inline const Squares64::output_type Squares64::next() noexcept
+{
+    _internal_state.state.counter++;  // notice: modulo 2^64 increment
+
+    value_type x, y, z, t;
+
+    x = y = _internal_state.state.counter * _internal_state.state.key;
+    z = y + _internal_state.state.key;
+
+    // squaring - round 1
+    x = x * x + y;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 2
+    x = x * x + z;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 3
+    x = x * x + y;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 4
+    t = x = x * x + z;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 5
+    return t ^ ((x * x + y) >> 32);
+}
+
 /** @}*/
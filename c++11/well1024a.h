@@ -115,11 +115,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Well1024a : public BaseWell<32>
+class Well1024a : public BaseWell<32, Well1024a>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseWell<32>;
+    using MyBaseClass = BaseWell<32, Well1024a>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -140,7 +140,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
 
 };
 
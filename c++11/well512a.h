@@ -114,11 +114,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Well512a : public BaseWell<16>
+class Well512a : public BaseWell<16, Well512a>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseWell<16>;
+    using MyBaseClass = BaseWell<16, Well512a>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -139,7 +139,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
 
 };
 
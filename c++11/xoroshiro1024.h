@@ -96,11 +96,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Xoroshiro1024 : public BaseXoroshiro<16>
+class Xoroshiro1024 : public BaseXoroshiro<16, Xoroshiro1024>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseXoroshiro<16>;
+    using MyBaseClass = BaseXoroshiro<16, Xoroshiro1024>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -121,7 +121,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;         //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual const output_type next() noexcept override final;   //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
 
 };
 
@@ -98,11 +98,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Xoroshiro256 : public BaseXoroshiro<4>
+class Xoroshiro256 : public BaseXoroshiro<4, Xoroshiro256>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseXoroshiro<4>;
+    using MyBaseClass = BaseXoroshiro<4, Xoroshiro256>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -123,7 +123,7 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;         //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual const output_type next() noexcept override final;   //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
 
 };
 
@@ -123,12 +123,12 @@ SOFTWARE.
 *   should definitively pass.
 */
 
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS = 8 * sizeof(OutputType)>
-class BaseCWG : public BaseRandom<CollatzWeylState<ValueType, StateValueType>, OutputType, OUTPUT_BITS>
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS = 8 * sizeof(OutputType), typename EngineT = void>
+class BaseCWG : public BaseRandom<CollatzWeylState<ValueType, StateValueType>, OutputType, OUTPUT_BITS, EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<CollatzWeylState<ValueType, StateValueType>, OutputType, OUTPUT_BITS>;
+    using MyBaseClass = BaseRandom<CollatzWeylState<ValueType, StateValueType>, OutputType, OUTPUT_BITS, EngineT>;
 
     using output_type = typename MyBaseClass::output_type;
     using state_type = typename MyBaseClass::state_type;
@@ -174,8 +174,8 @@ public:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG() noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG() noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed();
@@ -183,8 +183,8 @@ inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG() no
 
 //---------------------------------------------------------------------------
 /** Valued construtor (int). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const int seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -192,8 +192,8 @@ inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(cons
 
 //---------------------------------------------------------------------------
 /** Valued construtor (unsigned int). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const unsigned int seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -201,48 +201,48 @@ inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(cons
 
 //---------------------------------------------------------------------------
 /** Valued construtor (long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 /** Valued construtor (unsigned long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const unsigned long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 /** Valued construtor (long long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const long long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 /** Valued construtor (unsigned long long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const unsigned long long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
 }
 
 /** Valued construtor (128-bits integer). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const utils::UInt128& seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
 }
 
 /** Valued construtor (double). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const double seed_)
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -250,8 +250,8 @@ inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(cons
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(const state_type& internal_state) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::BaseCWG(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -259,88 +259,88 @@ inline BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::BaseCWG(cons
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed() noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed() noexcept
 {
     _setstate(utils::set_random_seed64());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const int seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const unsigned int seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const unsigned int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const unsigned long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const unsigned long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const long long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const long long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const unsigned long long seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const utils::UInt128& seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::seed(const double seed_)
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::_setstate(const std::uint64_t seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS>
-inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS>::_setstate(const utils::UInt128& seed_) noexcept
+template<typename ValueType, typename StateValueType, typename OutputType, const std::uint32_t OUTPUT_BITS, typename EngineT>
+inline void BaseCWG<ValueType, StateValueType, OutputType, OUTPUT_BITS, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
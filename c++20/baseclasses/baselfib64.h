@@ -55,6 +55,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
 #include <cstdint>
 
 #include "baserandom.h"
@@ -131,11 +132,11 @@ SOFTWARE.
 *   should definitively pass.
 */
 template<const std::uint32_t SIZE, const std::uint32_t K>
-class BaseLFib64 : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>
+class BaseLFib64 : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, BaseLFib64<SIZE, K>>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, BaseLFib64<SIZE, K>>;
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
     using value_type  = typename state_type::value_type;
@@ -161,7 +162,8 @@ public:
 
 
     //---   Internal PRNG   -------------------------------------------------
-    virtual const output_type next() noexcept override;             //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final;            //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
     inline void _initIndex(const size_t _index) noexcept;           //!< Inits the internal index pointing to the internal list.
 
@@ -287,12 +289,47 @@ const typename BaseLFib64<SIZE, K>::output_type BaseLFib64<SIZE, K>::next() noex
     MyBaseClass::_internal_state.state.list[index] = value;
 
     // next index
-    MyBaseClass::_internal_state.state.index = (index + 1) % SEED_SIZE;
+    MyBaseClass::_internal_state.state.index = (index < SEED_SIZE - 1) ? index + 1 : 0;
 
     // finally, returns pseudo random value as a 64-bits integer
     return value;
 }
 
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+template<const std::uint32_t SIZE, std::uint32_t K >
+void BaseLFib64<SIZE, K>::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over the two segments of the internal list in which
+    // the lagged values are at constant distances, i.e. index + SIZE - K in [0, K) and index - K in
+    // [K, SIZE). The distances being known at compile time, each loop gets vectorized by compilers.
+    value_type* const list{ MyBaseClass::_internal_state.state.list.data() };
+    std::uint32_t index{ MyBaseClass::_internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_end{ index < K ? K : SIZE };
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(segment_end - index, remaining)) };
+        const std::uint32_t stop{ index + count };
+
+        if (index < K) {
+            const value_type* const lagged{ list + (SIZE - K) };
+            for (std::uint32_t i = index; i < stop; ++i)
+                *out++ = list[i] += lagged[i];
+        }
+        else {
+            for (std::uint32_t i = index; i < stop; ++i)
+                *out++ = list[i] += list[i - K];
+        }
+
+        remaining -= count;
+        index = (stop == SIZE) ? 0 : stop;
+    }
+
+    MyBaseClass::_internal_state.state.index = index;
+}
+
 //---------------------------------------------------------------------------
 /** Inits the internal index pointing to the internal list. */
 template<const std::uint32_t SIZE, std::uint32_t K >
@@ -116,12 +116,12 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-class BaseMELG : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t>
+template<const std::uint32_t SIZE, typename EngineT = void>
+class BaseMELG : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>;
 
     using output_type = typename MyBaseClass::output_type;
     using state_type = typename MyBaseClass::state_type;
@@ -167,8 +167,8 @@ public:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG() noexcept
     : MyBaseClass()
 {
     seed();
@@ -176,8 +176,8 @@ inline BaseMELG<SIZE>::BaseMELG() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (int). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -185,8 +185,8 @@ inline BaseMELG<SIZE>::BaseMELG(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned int). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -194,8 +194,8 @@ inline BaseMELG<SIZE>::BaseMELG(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -203,8 +203,8 @@ inline BaseMELG<SIZE>::BaseMELG(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -212,8 +212,8 @@ inline BaseMELG<SIZE>::BaseMELG(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -221,8 +221,8 @@ inline BaseMELG<SIZE>::BaseMELG(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -230,8 +230,8 @@ inline BaseMELG<SIZE>::BaseMELG(const unsigned long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned 128 bits). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -239,8 +239,8 @@ inline BaseMELG<SIZE>::BaseMELG(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (double). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -248,8 +248,8 @@ inline BaseMELG<SIZE>::BaseMELG(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseMELG<SIZE>::BaseMELG(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMELG<SIZE, EngineT>::BaseMELG(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -257,88 +257,88 @@ inline BaseMELG<SIZE>::BaseMELG(const state_type& internal_state) noexcept
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed() noexcept
 {
     MyBaseClass::seed();
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-*bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMELG<SIZE>::_setstate(const utils::UInt128& seed) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMELG<SIZE, EngineT>::_setstate(const utils::UInt128& seed) noexcept
 {
     MyBaseClass::_setstate(seed);
 }
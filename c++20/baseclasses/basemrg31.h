@@ -121,11 +121,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-struct BaseMRG31 : public BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31>
+template<const std::uint32_t SIZE, typename EngineT = void>
+struct BaseMRG31 : public BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31, EngineT>
 {
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix31, std::uint32_t, SIZE>, std::uint32_t, 31, EngineT>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -166,6 +166,10 @@ struct BaseMRG31 : public BaseRandom<ListSeedState<utils::SplitMix31, std::uint3
     virtual inline void _setstate(const std::uint64_t   seed) noexcept override;    //!< Sets the internal state of this PRNG with a 64-bits integer seed.
     virtual inline void _setstate(const utils::UInt128& seed) noexcept override;    //!< Sets the internal state of this PRNG with a 128-bits integer seed.
 
+
+protected:
+    static inline const std::uint64_t _mod_31(const std::uint64_t x) noexcept;    //!< Returns x modulo (2^31 - 1), without any division.
+
 };
 
 
@@ -173,8 +177,8 @@ struct BaseMRG31 : public BaseRandom<ListSeedState<utils::SplitMix31, std::uint3
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31() noexcept
     : MyBaseClass()
 {
     seed();
@@ -182,8 +186,8 @@ inline BaseMRG31<SIZE>::BaseMRG31() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -191,8 +195,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -200,8 +204,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -209,8 +213,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -218,8 +222,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (long long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -227,8 +231,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -236,8 +240,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const unsigned long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -245,8 +249,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor (double). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -254,8 +258,8 @@ inline BaseMRG31<SIZE>::BaseMRG31(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseMRG31<SIZE>::BaseMRG31(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG31<SIZE, EngineT>::BaseMRG31(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -263,90 +267,106 @@ inline BaseMRG31<SIZE>::BaseMRG31(const state_type& internal_state) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed() noexcept
 {
     _setstate(utils::set_random_seed31());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG31<SIZE>::_setstate(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG31<SIZE, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
 }
 
+//---------------------------------------------------------------------------
+/** Returns x modulo (2^31 - 1), without any division.
+*
+* Since 2^31 = 1 modulo (2^31 - 1), the upper bits of x can be added to its
+* 31 lower bits. Two such folds get a value not greater than 2^31 + 6, and
+* one final conditional subtraction gets the same result as x % (2^31 - 1)
+* for any 64-bits x.
+*/
+template<const std::uint32_t SIZE, typename EngineT>
+inline const std::uint64_t BaseMRG31<SIZE, EngineT>::_mod_31(const std::uint64_t x) noexcept
+{
+    std::uint64_t r{ (x & MyBaseClass::_MODULO) + (x >> 31) };
+    r = (r & MyBaseClass::_MODULO) + (r >> 31);
+    return (r >= MyBaseClass::_MODULO) ? r - MyBaseClass::_MODULO : r;
+}
+
 /** @}*/
@@ -104,11 +104,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-struct BaseMRG32 : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32>
+template<const std::uint32_t SIZE, typename EngineT = void>
+struct BaseMRG32 : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32, EngineT>
 {
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix32, std::uint32_t, SIZE>, std::uint32_t, 32, EngineT>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -156,8 +156,8 @@ struct BaseMRG32 : public BaseRandom<ListSeedState<utils::SplitMix32, std::uint3
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32() noexcept
     : MyBaseClass()
 {
     seed();
@@ -165,8 +165,8 @@ inline BaseMRG32<SIZE>::BaseMRG32() noexcept
 
 //-------------------------------------------
 /** Valued constructor (int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -174,8 +174,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const int seed_) noexcept
 
 //-------------------------------------------
 /** Valued constructor (unsigned int). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -183,8 +183,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const unsigned int seed_) noexcept
 
 //-------------------------------------------
 /** Valued constructor (long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -192,8 +192,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const long seed_) noexcept
 
 //-------------------------------------------
 /** Valued constructor (unsigned long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -201,8 +201,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long seed_) noexcept
 
 //-------------------------------------------
 /** Valued constructor (long long). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -210,8 +210,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const long long seed_) noexcept
 
 //-------------------------------------------
 /** Valued constructo (unsigned long long)r. */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -219,8 +219,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const unsigned long long seed_) noexcept
 
 //-------------------------------------------
 /** Valued constructor (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -228,8 +228,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const utils::UInt128& seed_) noexcept
 
 //-------------------------------------------
 /** Valued constructor (double). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -237,8 +237,8 @@ inline BaseMRG32<SIZE>::BaseMRG32(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseMRG32<SIZE>::BaseMRG32(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseMRG32<SIZE, EngineT>::BaseMRG32(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -246,88 +246,88 @@ inline BaseMRG32<SIZE>::BaseMRG32(const state_type& internal_state) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed() noexcept
 {
     _setstate(utils::set_random_seed32());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseMRG32<SIZE>::_setstate(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseMRG32<SIZE, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
 }
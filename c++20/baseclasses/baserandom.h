@@ -42,13 +42,20 @@ SOFTWARE.
 #include <cstdint>
 #include <numeric>
 #include <ranges>
+#include <span>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "../exceptions.h"
+#include "../utils/discrete_sampler.h"
+#include "../utils/fenwick_tree.h"
+#include "../utils/parallel_chunks.h"
 #include "../utils/seed_generation.h"
 #include "../utils/type_traits.h"
 #include "../utils/uint128.h"
+#include "../utils/ziggurat.h"
 
 
 //===========================================================================
@@ -119,6 +126,16 @@ SOFTWARE.
 *   periods),  64-bits precision calculations and short memory consumption  (resp.  4,
 *   8 and 16 integers each coded on 64 bits.
 *
+*   Template argument EngineT is the final PRNG class that inherits from this class,
+*   as in the Curiously Recurring Template Pattern (CRTP). When it is set, every call
+*   to next() that is internal to this base class - i.e. by random(), uniform(),  the
+*   distributions functions,  shuffle(),  and so on - is statically dispatched to the
+*   final implementation EngineT::next(),  which may then get inlined. When it is let
+*   to its default value void, the internal calls to next() are dispatched  at  run-
+*   time through the virtual table, as they were before. Virtual method next() is in
+*   all cases still available for the users that need runtime polymorphism. All the
+*   PRNGs that are implemented in CppRandLib set EngineT to their own class.
+*
 *   Furthermore this class and all its inheriting sub-classes are callable. Example:
 * @code
 *     BaseRandom rand{}; // CAUTION: replace 'BaseRandom' with any inheriting class constructor!
@@ -159,7 +176,11 @@ SOFTWARE.
 *    |
 *    |  choices(population, weights=None, *, cum_weights=None, k=1)
 *    |      Important notice: CppRandLib implements this function via
-*    |      different signatures.
+*    |      different signatures. Weighted selections are made with an
+*    |      alias table (see utils::DiscreteSampler) rather than with a
+*    |      search in cumulative weights, and a prebuilt sampler can be
+*    |      passed in place of the weights when the same distribution is
+*    |      sampled many times.
 *    |      
 *    |      Python documentation:
 *    |      Return a k sized list of elements chosen from the population 
@@ -225,6 +246,20 @@ SOFTWARE.
 *    |      Not thread-safe without a lock around calls.
 *    |
 *    |
+*    |  gauss(values, mu, sigma)
+*    |      Fills a span of double or float values with Gaussian values.
+*    |
+*    |      This method is not available in PyRandLib.  Values are evaluated
+*    |      per pairs, in blocks that the compiler can vectorize.
+*    |
+*    |
+*    |  gauss_ziggurat(mu, sigma)
+*    |      Gaussian distribution, evaluated with the ziggurat method.
+*    |
+*    |      This method is not available in PyRandLib.  It is much faster
+*    |      than gauss() and keeps no value in the internal state.
+*    |
+*    |
 *    |  getrandbits(k)
 *    |      Returns a non-negative integer with k random bits. 
 *    |
@@ -311,6 +346,9 @@ SOFTWARE.
 *    |
 *    |  shuffle(x)
 *    |      x-> shuffle vector x in place.
+*    |      Important notice: CppRandLib provides also a parallel version
+*    |      shuffle(x, workers_count), which is deterministic for a given
+*    |      state of the PRNG and a given count of workers.
 *    |
 *    |
 *    |  triangular()
@@ -351,7 +389,8 @@ SOFTWARE.
 template<
     typename StateT,
     typename OutputT = std::uint32_t,
-    const std::uint8_t OUTPUT_BITS = 8 * sizeof(OutputT)
+    const std::uint8_t OUTPUT_BITS = 8 * sizeof(OutputT),
+    typename EngineT = void
 >
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 class BaseRandom
@@ -402,22 +441,44 @@ public:
     }
 
 
+    //---   Bulk generation   -----------------------------------------------
+    /** @brief Fills a span with successive outputs of the internal PRNG.
+    *
+    * Evaluates as many values as the span contains with one single  virtual
+    * call, rather than one per value. Results are the same as if next() was
+    * called in a loop. This method SHOULD be overridden in inheriting classes
+    * with a tight non-virtual loop on their own internal PRNG algorithm.
+    * @param values: the span to be filled with pseudo-random integer values.
+    */
+    inline virtual void fill(std::span<output_type> values) noexcept
+    {
+        for (output_type& value : values)
+            value = _next();
+    }
+
+
     //---   Uniform [0, 1.0) random   ---------------------------------------
     /** @brief The uniform distribution on [0.0, 1.0).
     *
+    * float and double values are built from the 24 and 53 most significant
+    * bits of the internal PRNG outputs,  so that no rounding can ever lead
+    * to 1.0.  long double values keep on using all the output bits.
     * @return a double value uniformly contained within range [0.0, 1.0).
     */
     template<typename T = double>
         requires std::is_floating_point_v<T>
     inline const T random() noexcept
     {
-        return T(double(next()) * _NORMALIZE);
+        if constexpr (std::is_same_v<T, float>)
+            return _random_float();
+        else
+            return T(_random_double());
     }
 
     template<>
     inline const long double random() noexcept
     {
-        return (long double)next() * _NORMALIZE_LD;
+        return (long double)_next() * _NORMALIZE_LD;
     }
 
 
@@ -511,7 +572,18 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    /** @brief Returns the number of successes for n>=0 independent trials. */
+    /** @brief Returns the number of successes for n>=0 independent trials.
+    *
+    * Uses inversion - i.e. a sequential search over the cumulative distribution
+    * function - when n * p < 10,  and W. Hoermann's BTRS algorithm  (i.e.
+    * transformed rejection with squeeze) otherwise. Running time is then
+    * bounded whatever the value of n. The parameters dependent setup of the
+    * distribution is cached and is evaluated once only for successive calls
+    * with same n and p.
+    *
+    * Important notice:  the BTRS code is a translation from Python
+    * https://github.com/python/cpython/blob/3.12/Lib/random.py into c++.
+    */
     template<typename CountT, typename ProbaT>
         requires std::is_integral_v<CountT>&& std::is_floating_point_v<ProbaT>
     const CountT binomialvariate(const CountT n = 1, const ProbaT p = ProbaT(0.5));
@@ -527,7 +599,7 @@ public:
     {
         if (n == 0)
             throw ChoiceEmptySequenceException();
-        return seq[uniform<T>(n)];
+        return seq[uniform<std::size_t>(n)];
     }
 
 
@@ -538,8 +610,12 @@ public:
     /** @brief Returns a k sized vector of elements chosen from the population with replacement (individual weights). */
     template<typename T, typename C>
         requires std::is_arithmetic_v<C>
-    std::vector<T> choices(const std::vector<T>& population, std::vector<C>& weights, const std::size_t k);
-    
+    std::vector<T> choices(const std::vector<T>& population, const std::vector<C>& weights, const std::size_t k);
+
+    /** @brief Returns a k sized vector of elements chosen from the population with replacement (prebuilt weights sampler). */
+    template<typename T>
+    std::vector<T> choices(const std::vector<T>& population, const utils::DiscreteSampler& sampler, const std::size_t k);
+
     /** @brief Returns a k sized vector of elements chosen from the population with replacement (cumulative weights). */
     template<typename T, typename C>
         requires std::is_arithmetic_v<C>
@@ -555,7 +631,7 @@ public:
             throw TooMuchReturnedBitsException<OutputT>();
 
         const unsigned int rot{ OUTPUT_BITS - k };
-        const OutputT n{ next() };
+        const OutputT n{ _next() };
         const OutputT ret{ n >> rot };
         return ret;
     }
@@ -718,18 +794,22 @@ public:
         if (k > n)
             throw SampleCountException(k, n);
 
-        std::array<T, n> samples{ population };
-
-        auto out_it{ out.begin() };
-        for (std::size_t i = 0; i < k; ++i) {
-            const std::size_t index = uniform<std::size_t>(i, n);
-            *out_it++ = samples[index];
-            if (i != index)
-                std::swap(samples[i], samples[index]);
-        }
+        _sample_population<T>(out, population);
     }
 
 
+    /** @brief Chooses k unique random indexes in range [0, n).
+    *
+    * Evaluates a vector containing k different indexes  in  selection  order,
+    * i.e. the k first indexes of a random permutation of range [0, n).  This
+    * is the selection that method sample() applies to populations of size n.
+    * It may be used to sample containers other than std::vector or std::array,
+    * or to get the positions of the selected elements rather than copies of
+    * them.
+    */
+    void sample_indexes(std::vector<std::size_t>& out, const std::size_t n, const std::size_t k);
+
+
     /** @brief Chooses k unique random elements from a population sequence (std::vector<>, with counts vector).
     *
     * Evaluates a vector containing  elements  from  the  population  while
@@ -774,25 +854,11 @@ public:
         requires std::is_integral_v<C> && (k != 0)
     void sample(std::array<T, k>& out, const std::array<T, n>& population, const std::array<C, n>& counts)
     {
-        const std::size_t samples_count = std::size_t(std::accumulate(counts.begin(), counts.end(), C(0)));
+        const std::uint64_t samples_count{ _counts_total<C>(counts) };
         if (k > samples_count)
             throw SampleCountException(k, samples_count);
 
-        std::vector<T> samples(samples_count);
-        auto c_it = counts.begin();
-        auto s_it{ samples.begin() };
-        for (auto& p : population) {
-            for (std::size_t j = std::size_t(*c_it++); j > 0; --j)
-                *s_it++ = p;
-        }
-
-        auto out_it{ out.begin() };
-        for (std::size_t i = 0; i < k; ++i) {
-            const std::size_t index = uniform<std::size_t>(i, samples_count);
-            *out_it++ = samples[index];
-            if (i != index)
-                std::swap(samples[i], samples[index]);
-        }
+        _sample_counts<T, C>(out, population, counts);
     }
 
 
@@ -843,11 +909,35 @@ public:
 
     /** @brief In place Shuffles the specified sequence.
     *
-    * The Container type must be either std::vector or std::array.
+    * The Container type may be any sized random access range,  e.g. either
+    * std::vector, std::array, std::deque or std::span.
+    */
+    template<typename ContainerType>
+        requires std::ranges::random_access_range<ContainerType> && std::ranges::sized_range<ContainerType>
+    void shuffle(ContainerType&& seq);
+
+    /** @brief In place shuffles the specified sequence with parallel workers.
+    *
+    * Implements the parallel shuffling of P. Sanders ("Random Permutations on
+    * Distributed, External and Hierarchical Memory", Information Processing
+    * Letters, 67(6):305-309, 1998).  The sequence is split in as many chunks
+    * as there are workers.  Each worker scatters the elements of its chunk to
+    * randomly chosen buckets, one bucket per worker, then each worker shuffles
+    * one bucket with a Fisher-Yates shuffle. Scatters are made from and to
+    * a few contiguous memory areas only, so that they remain cache friendly.
+    *
+    * Each worker gets its own independent substream, i.e. a PRNG of the same
+    * type as this one, seeded from outputs of this PRNG. The final order of
+    * the elements is then deterministic for a given internal state of this
+    * PRNG and a given count of workers, whatever the scheduling of threads.
+    *
+    * A temporary buffer of the same size as the sequence is used. Sequences
+    * with less than 65,536 elements per worker are shuffled sequentially.
     */
     template<typename ContainerType>
-        requires utils::is_indexable_v<ContainerType>
-    void shuffle(ContainerType& seq);
+        requires std::ranges::random_access_range<ContainerType> && std::ranges::sized_range<ContainerType> &&
+                 std::default_initializable<std::ranges::range_value_t<ContainerType>> && (!std::is_void_v<EngineT>)
+    void shuffle(ContainerType&& seq, const std::size_t workers_count);
 
 
     //---   Random distribution functions   ---------------------------------
@@ -872,8 +962,8 @@ public:
     * @return a value in range [0.0, Infinity) if lambda is  positive,  or
     *   a value in range (-Infinity, 0.0] if lambda is negative.
     *
-    * Important notice:  the implemented code is a translation from Python
-    * https://github.com/python/cpython/blob/3.11/Lib/random.py into c++.
+    * Notice: values are evaluated with the ziggurat method,  with no call to
+    * any transcendental function in about 99% of the cases.
     */
     const double expovariate(const double lambda = 1.0);
 
@@ -896,11 +986,11 @@ public:
     * @param beta : double, the scale parameter - must be greater than 0.0.
     *   With these two arguments: mean is alpha * beta and variance is alpha * beta * beta
     *
-    * Important notice:  the implemented code is a translation from Python
-    * https://github.com/python/cpython/blob/3.11/Lib/random.py into c++.
-    * As such, some comments present in the Python original code have been
-    * copied as is in this c++ implementation, naming then the authors of
-    * the related parts of code.
+    * Values are evaluated with G. Marsaglia and W. W. Tsang's method,  with
+    * one normal and one uniform values per accepted sample and about 98% of
+    * acceptance - alpha being boosted by 1 when it is less than 1.0.  When
+    * alpha is 1.0,  this is the exponential distribution with lambda set to
+    * 1 / beta.
     */
     const double gammavariate(const double alpha, const double beta);
 
@@ -930,6 +1020,49 @@ public:
     const double gauss(const double mu, const double sigma);
 
 
+    /** @brief Fills a span with Gaussian values (mean=mu, stdev=sigma).
+    *
+    * mu is the mean, and sigma is the standard deviation.
+    * mu can be any value, sigma must be greater than 0.0.
+    *
+    * The Box-Muller transform is applied to blocks of pairs of uniform values:
+    * all the uniform values of a block are drawn first,  then log, sqrt, cos
+    * and sin are evaluated in separate loops with no dependency between their
+    * iterations,  which compilers vectorize when a vector math library is
+    * available (e.g. gcc with -ffast-math and glibc libmvec).  The value kept in
+    * the internal state by method gauss() is neither used nor modified.
+    */
+    void gauss(std::span<double> values, const double mu = 0.0, const double sigma = 1.0);
+
+
+    /** @brief Fills a span with Gaussian values (mean=mu, stdev=sigma), simple precision version.
+    *
+    * See gauss(std::span<double>, mu, sigma) above.  The transcendental
+    * functions are evaluated in simple precision.
+    */
+    void gauss(std::span<float> values, const float mu = 0.0f, const float sigma = 1.0f);
+
+
+    /** @brief Default Gaussian distribution (mean=0.0, stdev=1.0), ziggurat method.
+    *
+    * Implements the ziggurat method of G. Marsaglia and W. W. Tsang,  with
+    * 256 precomputed layers (see utils/ziggurat.h). About 99% of the values
+    * are evaluated from one single 64-bits random draw,  with no call to any
+    * transcendental function.  This is much faster than gauss(),  while no
+    * value is kept in the internal state between successive calls.
+    */
+    inline const double gauss_ziggurat() noexcept;
+
+
+    /** @brief Gaussian distribution (mean=mu, stdev=sigma), ziggurat method.
+    *
+    * mu is the mean, and sigma is the standard deviation.
+    * mu can be any value, sigma must be greater than 0.0.
+    * See gauss_ziggurat() above.
+    */
+    inline const double gauss_ziggurat(const double mu, const double sigma);
+
+
     /** @brief Default Log normal distribution (mean=0.0, stdev=1.0).
     *
     * If you take the natural logarithm of this distribution, you'll get
@@ -998,8 +1131,8 @@ public:
     *
     * @param alpha: double, the shape parameter. Cannot be 0.0.
     *
-    * Important notice:  the implemented code is a translation from Python
-    * https://github.com/python/cpython/blob/3.11/Lib/random.py into c++.
+    * Notice: evaluated as exp(E / alpha), with E drawn from the ziggurat
+    * exponential distribution.
     */
     const double paretovariate(const double alpha);
 
@@ -1026,7 +1159,11 @@ public:
     inline const T uniform() noexcept;
 
 
-    /** @brief Uniform distribution [0.0, max). */
+    /** @brief Uniform distribution [0.0, max).
+    *
+    * When both T and U are integral types, the returned value is an unbiased
+    * integer value in [0, max), or in (max, 0] when max is negative.
+    */
     template<typename T = double, typename U = T>
         requires std::is_arithmetic_v<T> && std::is_arithmetic_v<U>
     inline const T uniform(const U max) noexcept;
@@ -1050,7 +1187,11 @@ public:
     }
 
 
-    /** @brief Uniform distribution in [min, max).*/
+    /** @brief Uniform distribution in [min, max).
+    *
+    * When T, U and V are all integral types, the returned value is an unbiased
+    * integer value in [min, max).
+    */
     template<typename T, typename U = T, typename V = U>
         requires std::is_arithmetic_v<T> && std::is_arithmetic_v<U> && std::is_arithmetic_v<V>
     inline const T uniform(const U min, const V max) noexcept;
@@ -1076,6 +1217,9 @@ public:
     *
     * @param alpha: double, the scale parameter.
     * @param beta: double, the shape parameter. Must be non null.
+    *
+    * Notice: evaluated as alpha * E^(1/beta), with E drawn from the ziggurat
+    * exponential distribution.
     */
     const double weibullvariate(const double alpha, const double beta);
 
@@ -1093,6 +1237,8 @@ protected:
     static const double RECIP_BPF;
     static const double SG_MAGICCONST;
 
+    static constexpr std::size_t _SAMPLE_SPARSE_RATIO{ 16 };  // notice: hash tables get worth it when less than n/16 indexes are drawn
+
     static constexpr std::uint64_t _MODULO{ (((1ull << ((OUTPUT_BITS > 64 ? 64 : OUTPUT_BITS) - 1)) - 1) << 1) | 0x1 };  // notice: complex formula to avoid warning on bits overflow, should be (1 << OUTPUT_BITS) - 1
 
     static constexpr long double _NORMALIZE_LD{ (OUTPUT_BITS <= 64)
@@ -1101,6 +1247,125 @@ protected:
     };
     static constexpr double _NORMALIZE{ double(_NORMALIZE_LD) };
 
+    static constexpr float _NORMALIZE_24{ 1.0f / 16'777'216.0f };  // i.e. 1.0 / (1 << 24)
+    static constexpr double _NORMALIZE_53{ 1.0 / 9'007'199'254'740'992.0 };  // i.e. 1.0 / (1 << 53)
+
+
+    //---   Internal PRNG   -------------------------------------------------
+    /** @brief Statically dispatched call to the internal PRNG algorithm.
+    *
+    * Calls EngineT::next() without any virtual call when template argument
+    * EngineT is set, or the virtual method next() otherwise.
+    */
+    inline const output_type _next() noexcept
+    {
+        if constexpr (std::is_void_v<EngineT>)
+            return next();
+        else
+            return static_cast<EngineT*>(this)->EngineT::next();
+    }
+
+
+    //---   Bounded integers   ----------------------------------------------
+    /** @brief Returns an unbiased uniform integer value in range [0, range).
+    *
+    * Implements D. Lemire's nearly divisionless method (see "Fast Random
+    * Integer Generation in an Interval", ACM Trans. on Modeling and Computer
+    * Simulation, 2019): the returned value is the high part of the product of
+    * a random integer by range,  while a rare rejection step on its low part
+    * removes any bias. 32-bits ranges are evaluated with a 32x32->64 bits
+    * product,  64-bits ones with a 64x64->128 bits product or, for the PRNGs
+    * with 128-bits outputs, with a 128x64->192 bits product. Returns 0 when
+    * range is 0.
+    */
+    template<typename R>
+        requires std::is_unsigned_v<R>
+    inline const R _bounded(const R range) noexcept;
+
+    inline const std::uint32_t _bounded32(const std::uint32_t range) noexcept;     //!< 32-bits ranges, Lemire's method.
+    inline const std::uint64_t _bounded64(const std::uint64_t range) noexcept;     //!< 64-bits ranges, Lemire's method.
+    inline const std::uint64_t _bounded128(const std::uint64_t range) noexcept;    //!< 64-bits ranges with 128-bits outputs, Lemire's method.
+
+    inline const std::uint32_t _random_bits32() noexcept;   //!< Returns 32 random bits, from the most significant ones of the internal PRNG outputs.
+    inline const std::uint64_t _random_bits64() noexcept;   //!< Returns 64 random bits, from the most significant ones of the internal PRNG outputs.
+
+
+    //---   Floating point conversions   ------------------------------------
+    inline const float _random_float() noexcept;    //!< Returns a float value in [0.0, 1.0), built from the 24 most significant bits of the internal PRNG outputs.
+    inline const double _random_double() noexcept;  //!< Returns a double value in [0.0, 1.0), built from the 53 most significant bits of the internal PRNG outputs.
+
+
+    //---   Ziggurat samplers   ---------------------------------------------
+    /** @brief Exponential distribution (lambda=1.0), ziggurat method.
+    *
+    * Implements the ziggurat method of G. Marsaglia and W. W. Tsang,  with
+    * 256 precomputed layers (see utils/ziggurat.h). About 99% of the values
+    * are evaluated from one single 64-bits random draw,  with no call to any
+    * transcendental function.
+    */
+    inline const double _expo_ziggurat() noexcept;
+
+
+    //---   Sampling   ------------------------------------------------------
+    /** @brief Evaluates the first indexes of a random permutation of range [0, n), as many as the span contains.
+    *
+    * This is a partial Fisher-Yates shuffle of the indexes, which is the one
+    * of Python's sample() for small populations. The shuffled indexes  are
+    * stored in a dense vector when the count of drawn indexes is not far less
+    * than n. Otherwise only the  displaced  indexes  are  kept  in  a  hash
+    * table,  and the memory usage is then O(k) whatever n.  Both cases get
+    * exactly the same indexes from the same internal state.
+    */
+    void _sample_indexes(std::span<std::size_t> indexes, const std::size_t n);
+
+    /** @brief Chooses unique random elements from a population, as many as the out span contains.
+    *
+    * When the elements are not larger than indexes and the count of drawn
+    * elements is not far less than n,  the partial Fisher-Yates shuffle is
+    * applied on a copy of the population, which is then never larger than
+    * the vector of its indexes. Otherwise, the elements are gathered  from
+    * the indexes evaluated by _sample_indexes().  Both cases get the  same
+    * elements from the same internal state.
+    */
+    template<typename T>
+    void _sample_population(std::span<T> out, std::span<const T> population);
+
+    /** @brief Chooses unique random elements from a population with counts, as many as the out span contains.
+    *
+    * The counts of elements are stored in a Fenwick tree,  and the count of
+    * each drawn element is then decreased.  This gets a time of  O(k log n)
+    * and a memory usage of O(n), whatever the sum of all counts. The sum of
+    * all counts must not be less than the size of out.
+    */
+    template<typename T, typename C>
+        requires std::is_integral_v<C>
+    void _sample_counts(std::span<T> out, std::span<const T> population, std::span<const C> counts);
+
+    /** @brief Returns the sum of the counts of elements, checking that none is negative. */
+    template<typename C>
+        requires std::is_integral_v<C>
+    static const std::uint64_t _counts_total(std::span<const C> counts);
+
+
+    //---   Distributions setups   ------------------------------------------
+    /** @brief The cached setup of the binomial distribution, for the last evaluated couple (n, p). */
+    struct _BinomialSetup
+    {
+        double n{ -1.0 };   //!< the count of trials, negative when not set yet
+        double p{ -1.0 };   //!< the probability of success, less than or equal to 0.5
+
+        // inversion, when n * p < 10
+        double q_n{};       //!< the probability of 0 success, i.e. (1-p)^n
+        double s{};         //!< p / (1-p)
+        double ns{};        //!< (n+1) * p / (1-p)
+
+        // BTRS, when n * p >= 10
+        double spq{};       //!< the standard deviation of the distribution
+        double a{}, b{}, c{}, vr{}, alpha{}, lpq{};
+        double m{};         //!< the mode of the distribution
+        double h{};         //!< lgamma(m + 1) + lgamma(n - m + 1)
+    } _binomial_setup;
+
 
     //---   Operations   ----------------------------------------------------
     /** @brief Sets the internal state with an integer seed.
@@ -1122,45 +1387,45 @@ protected:
 //===========================================================================
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::E{ std::exp(1.0) };
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::E{ std::exp(1.0) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::LOG4{ std::log(4.0) };
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::LOG4{ std::log(4.0) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::NV_MAGICCONST{ 4 * std::exp(-0.5) / std::sqrt(2.0) };
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::NV_MAGICCONST{ 4 * std::exp(-0.5) / std::sqrt(2.0) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::RECIP_BPF{ std::exp2(-BPF) };
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::RECIP_BPF{ std::exp2(-BPF) };
 
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::SG_MAGICCONST{ 1.0 + std::log(4.5) };
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::SG_MAGICCONST{ 1.0 + std::log(4.5) };
 
 
 //---------------------------------------------------------------------------
 /** Valued call operator (1 scalar). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_arithmetic_v<T>
-const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T max) noexcept
+const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const T max) noexcept
 {
     return uniform<T>(max);
 }
 
 //---------------------------------------------------------------------------
 /** Valued call operator (max and n scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_arithmetic_v<T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T max, const std::size_t n) 
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const T max, const std::size_t n) 
 {
     if (n == 0)
         throw ZeroLengthException();
@@ -1172,11 +1437,11 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T max
 
 //---------------------------------------------------------------------------
 /** Valued call operator (min, max and n scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_arithmetic_v<T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T min, const T max, const std::size_t n)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const T min, const T max, const std::size_t n)
 {
     if (n == 0)
         throw ZeroLengthException();
@@ -1188,11 +1453,11 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const T min
 
 //---------------------------------------------------------------------------
 /** Valued call operator (1 std::vector of scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_arithmetic_v<T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::vector<T>& max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const std::vector<T>& max)
 {
     std::vector<T> out(max.size());
     auto max_it{ max.cbegin() };
@@ -1202,11 +1467,11 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::
 
 //---------------------------------------------------------------------------
 /** Valued call operator (2 std::vector of scalars). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_arithmetic_v<T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::vector<T>& min, const std::vector<T>& max) noexcept
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::operator() (const std::vector<T>& min, const std::vector<T>& max) noexcept
 {
     const std::size_t count = std::min(min.size(), max.size());
     std::vector<T> out(count);
@@ -1218,45 +1483,114 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::operator() (const std::
 
 //---------------------------------------------------------------------------
 /** Returns the number of successes for n>=0 independent trials. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename CountT, typename ProbaT>
     requires std::is_integral_v<CountT> && std::is_floating_point_v<ProbaT>
-const CountT BaseRandom<StateT, OutputT, OUTPUT_BITS>::binomialvariate(CountT n, const ProbaT p)
+const CountT BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::binomialvariate(CountT n, const ProbaT p)
 {
     if (n < 0)
         throw PositiveValueException(n);
     if (p < 0.0 || p > 1.0)
         throw ProbaOutOfRangeException(p);
 
-    CountT count{ 0 };
-    while (n > 0) {
-        count += uniform<ProbaT>() < p;
-        --n;
+    // Edge cases
+    if (n == 0 || p == ProbaT(0))
+        return CountT(0);
+    if (p == ProbaT(1))
+        return n;
+
+    // Fast path for a common case
+    if (n == 1)
+        return CountT(uniform<ProbaT>() < p);
+
+    // Exploits symmetry to establish: p <= 0.5
+    if (p > ProbaT(0.5))
+        return n - binomialvariate(n, ProbaT(1) - p);
+
+    const double nd{ double(n) };
+    const double pd{ double(p) };
+    _BinomialSetup& setup{ _binomial_setup };
+
+    if (setup.n != nd || setup.p != pd) {
+        setup.n = nd;
+        setup.p = pd;
+        if (nd * pd < 10.0) {
+            setup.q_n = std::pow(1.0 - pd, nd);
+            setup.s = pd / (1.0 - pd);
+            setup.ns = (nd + 1.0) * setup.s;
+        }
+        else {
+            setup.spq = std::sqrt(nd * pd * (1.0 - pd));
+            setup.b = 1.15 + 2.53 * setup.spq;
+            setup.a = -0.0873 + 0.0248 * setup.b + 0.01 * pd;
+            setup.c = nd * pd + 0.5;
+            setup.vr = 0.92 - 4.2 / setup.b;
+            setup.alpha = (2.83 + 5.1 / setup.b) * setup.spq;
+            setup.lpq = std::log(pd / (1.0 - pd));
+            setup.m = std::floor((nd + 1.0) * pd);
+            setup.h = std::lgamma(setup.m + 1.0) + std::lgamma(nd - setup.m + 1.0);
+        }
     }
 
-    return count;
+    if (nd * pd < 10.0) {
+        // Inversion: sequential search, with O(n*p) running time
+        double u{ random() };
+        double r{ setup.q_n };
+        CountT x{ 0 };
+        while (u > r && x < n) {
+            u -= r;
+            ++x;
+            r *= setup.ns / double(x) - setup.s;  // i.e. P(x) = P(x-1) * (n - x + 1) / x * p / (1-p)
+        }
+        return x;
+    }
+    else {
+        // BTRS: Transformed rejection with squeeze method by W. Hoermann,
+        // "The generation of binomial random variates",
+        // Journal of Statistical Computation and Simulation, (1993), 46, p101 - 110
+        while (true) {  // notice: the expected count of loops is bounded whatever n and p
+            const double u{ random() - 0.5 };
+            const double us{ 0.5 - std::abs(u) };
+            const double k{ std::floor((2.0 * setup.a / us + setup.b) * u + setup.c) };
+            if (k < 0.0 || k > nd)
+                continue;
+
+            // The early-out "squeeze" test substantially reduces
+            // the number of acceptance condition evaluations.
+            double v{ random() };
+            if (us >= 0.07 && v <= setup.vr)
+                return CountT(k);
+
+            // Acceptance-rejection test.
+            // Note, the original paper erroneously omits the call to log(v)
+            // when comparing to the log of the rescaled binomial distribution.
+            v *= setup.alpha / (setup.a / (us * us) + setup.b);
+            if (std::log(v) <= setup.h - std::lgamma(k + 1.0) - std::lgamma(nd - k + 1.0) + (k - setup.m) * setup.lpq)
+                return CountT(k);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------
 /** Chooses a random element from a non-empty sequence (std::vector). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
-const T& BaseRandom<StateT, OutputT, OUTPUT_BITS>::choice(const std::vector<T>& seq)
+const T& BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choice(const std::vector<T>& seq)
 {
     const std::size_t n{ seq.size() };
     if (n == 0)
         throw ChoiceEmptySequenceException();
-    return seq[uniform<std::size_t>(T(n))];
+    return seq[uniform<std::size_t>(n)];
 }
 
 //---------------------------------------------------------------------------
 /** Returns a k sized vector of elements chosen from the population with replacement (same weights). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choices(
     const std::vector<T>& population,
     const std::size_t k
 )
@@ -1264,21 +1598,21 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
     if (population.size() == 0)
         throw ZeroLengthException();
 
-    std::vector<std::uint64_t> cum_weights(population.size());
-    std::iota(cum_weights.begin(), cum_weights.end(), 1);
+    std::vector<T> res(k);
+    std::ranges::generate(res, [&]() { return population[uniform<std::size_t>(population.size())]; });
 
-    return choices_cum<T, std::uint64_t>(population, cum_weights, k);
+    return res;
 }
 
 //---------------------------------------------------------------------------
 /** Returns a k sized vector of elements chosen from the population with replacement (individual weights). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename C>
     requires std::is_arithmetic_v<C>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choices(
     const std::vector<T>& population,
-    std::vector<C>& weights,
+    const std::vector<C>& weights,
     const std::size_t k
 )
 {
@@ -1287,18 +1621,38 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices(
     if (population.size() != weights.size())
         throw SampleSizesException(population.size(), weights.size());
 
-    std::partial_sum(weights.begin(), weights.end(), weights.begin());
+    return choices(population, utils::DiscreteSampler(weights), k);
+}
+
+//---------------------------------------------------------------------------
+/** Returns a k sized vector of elements chosen from the population with replacement (prebuilt weights sampler). */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+template<typename T>
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choices(
+    const std::vector<T>& population,
+    const utils::DiscreteSampler& sampler,
+    const std::size_t k
+)
+{
+    if (population.size() == 0)
+        throw ZeroLengthException();
+    if (population.size() != sampler.size())
+        throw SampleSizesException(population.size(), sampler.size());
+
+    std::vector<T> res(k);
+    std::ranges::generate(res, [&]() { return population[sampler.draw(*this)]; });
 
-    return choices_cum(population, weights, k);
+    return res;
 }
 
 //---------------------------------------------------------------------------
 /** Returns a k sized vector of elements chosen from the population with replacement (cumulative weights). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename C>
     requires std::is_arithmetic_v<C>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices_cum(
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::choices_cum(
     const std::vector<T>& population,
     const std::vector<C>& cum_weights,
     const std::size_t k
@@ -1309,40 +1663,32 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::choices_cum(
     if (population.size() != cum_weights.size())
         throw SampleSizesException(population.size(), cum_weights.size());
 
-    const C max_weight{ cum_weights.back() };
-    std::vector<T> res(k);
-    std::ranges::generate(res,
-        [&](){
-            return population[
-                std::distance(
-                    cum_weights.cbegin(),
-                    std::upper_bound(cum_weights.cbegin(), cum_weights.cend(), uniform<C>(max_weight))
-                )
-            ];
-        }
-    );
+    std::vector<double> weights(cum_weights.size());
+    weights[0] = double(cum_weights[0]);
+    for (std::size_t i = 1; i < weights.size(); ++i)
+        weights[i] = double(cum_weights[i]) - double(cum_weights[i - 1]);
 
-    return res;
+    return choices(population, utils::DiscreteSampler(weights), k);
 }
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values that are uniformly contained within range [0.0, 1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_floating_point_v<T>
-inline std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::size_t n)
+inline std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::size_t n)
 {
     return (*this)(T(1.0), n);
 }
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values that are uniformly contained within range [0, max). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename U>
     requires std::is_arithmetic_v<T>&& std::is_arithmetic_v<U>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::size_t n, const U max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::size_t n, const U max)
 {
     if (n == 0)
         throw ZeroLengthException();
@@ -1354,11 +1700,11 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::s
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values in range [0; max[i]). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename U>
     requires std::is_arithmetic_v<T> && std::is_arithmetic_v<U>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::vector<U>& max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::vector<U>& max)
 {
     const std::size_t n{ max.size() };
     if (n == 0)
@@ -1372,11 +1718,11 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::v
 
 //---------------------------------------------------------------------------
 /** Returns a vector of n values in range [min[i]; max[i]). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename U, typename V>
     requires std::is_arithmetic_v<T> && std::is_arithmetic_v<U> && std::is_arithmetic_v<V>
-std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::vector<U>& min, const std::vector<V>& max)
+std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::n_evaluate(const std::vector<U>& min, const std::vector<V>& max)
 {
     const std::size_t n{ std::min(min.size(), max.size()) };
     if (n == 0)
@@ -1391,9 +1737,9 @@ std::vector<T> BaseRandom<StateT, OutputT, OUTPUT_BITS>::n_evaluate(const std::v
 
 //---------------------------------------------------------------------------
 /** Generates n random bytes. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline std::vector<std::uint8_t> BaseRandom<StateT, OutputT, OUTPUT_BITS>::randbytes(const std::size_t n)
+inline std::vector<std::uint8_t> BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::randbytes(const std::size_t n)
 {
     if (n == 0)
         throw ZeroLengthException();
@@ -1405,11 +1751,11 @@ inline std::vector<std::uint8_t> BaseRandom<StateT, OutputT, OUTPUT_BITS>::randb
 
 //---------------------------------------------------------------------------
 /** Returns random integer in range [a, b], including both end points. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_integral_v<T>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randint(const T a, const T b) noexcept
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::randint(const T a, const T b) noexcept
 {
     if (a <= b)
         return uniform<T>(a, b + 1);
@@ -1420,11 +1766,11 @@ inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randint(const T a, cons
 
 //---------------------------------------------------------------------------
 /** Chooses a random item from range [start, stop) with specified step. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename S>
     requires std::is_arithmetic_v<T> && std::is_arithmetic_v<S>
-const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randrange(const T start, const T stop, const S step)
+const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::randrange(const T start, const T stop, const S step)
 {
     if (step == 0)
         throw RangeZeroStepException();
@@ -1447,10 +1793,10 @@ const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::randrange(const T start, const
 
 //---------------------------------------------------------------------------
 /** Chooses k unique random elements from a population sequence (out std::vector, in container, default counts = 1). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
-void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::sample(
     std::vector<T>& out,
     const std::vector<T>& population,
     const std::size_t k
@@ -1461,25 +1807,112 @@ void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
         throw SampleCountException(k, n);
 
     out.clear();
+    if constexpr (std::is_same_v<T, bool>) {
+        // notice: std::vector<bool> cannot be viewed as a span, the elements are gathered from the sampled indexes
+        std::vector<std::size_t> indexes(k);
+        _sample_indexes(indexes, n);
+
+        out.reserve(k);
+        for (const std::size_t index : indexes)
+            out.push_back(population[index]);
+    }
+    else {
+        out.resize(k);
+        _sample_population<T>(out, population);
+    }
+}
+
+//---------------------------------------------------------------------------
+/** Chooses k unique random indexes in range [0, n). */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::sample_indexes(
+    std::vector<std::size_t>& out,
+    const std::size_t n,
+    const std::size_t k
+)
+{
+    if (k > n)
+        throw SampleCountException(k, n);
+
     out.resize(k);
-    std::vector<T> samples{ population };
+    _sample_indexes(out, n);
+}
+
+//---------------------------------------------------------------------------
+/** Evaluates the first indexes of a random permutation of range [0, n), as many as the span contains. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_sample_indexes(std::span<std::size_t> indexes, const std::size_t n)
+{
+    const std::size_t k{ indexes.size() };
 
-    auto out_it = out.begin();
-    for (std::size_t i = 0; i < k; ++i) {
-        const std::size_t index = uniform<std::size_t>(i, n);
-        *out_it++ = samples[index];
-        if (i != index)
-            std::swap(samples[i], samples[index]);
+    if (n <= _SAMPLE_SPARSE_RATIO * k) {
+        // dense shuffling of all the indexes
+        std::vector<std::size_t> pool(n);
+        std::iota(pool.begin(), pool.end(), std::size_t(0));
+
+        for (std::size_t i = 0; i < k; ++i) {
+            const std::size_t j{ uniform<std::size_t>(i, n) };
+            indexes[i] = pool[j];
+            pool[j] = pool[i];
+        }
+    }
+    else {
+        // sparse shuffling, only the displaced indexes are stored
+        std::unordered_map<std::size_t, std::size_t> displaced;
+        displaced.reserve(k);
+
+        for (std::size_t i = 0; i < k; ++i) {
+            const std::size_t j{ uniform<std::size_t>(i, n) };
+            const auto j_it{ displaced.find(j) };
+            indexes[i] = (j_it == displaced.end()) ? j : j_it->second;
+
+            const auto i_it{ displaced.find(i) };
+            displaced[j] = (i_it == displaced.end()) ? i : i_it->second;
+        }
     }
 }
 
+//---------------------------------------------------------------------------
+/** Chooses unique random elements from a population, as many as the out span contains. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+template<typename T>
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_sample_population(std::span<T> out, std::span<const T> population)
+{
+    const std::size_t k{ out.size() };
+    const std::size_t n{ population.size() };
+
+    if constexpr (sizeof(T) <= sizeof(std::size_t)) {
+        if (n <= _SAMPLE_SPARSE_RATIO * k) {
+            // dense shuffling of a copy of the population, not larger than the vector of its indexes
+            std::vector<T> pool(population.begin(), population.end());
+
+            for (std::size_t i = 0; i < k; ++i) {
+                const std::size_t j{ uniform<std::size_t>(i, n) };
+                out[i] = pool[j];
+                pool[j] = pool[i];
+            }
+            return;
+        }
+    }
+
+    std::vector<std::size_t> indexes(k);
+    _sample_indexes(indexes, n);
+
+    auto out_it{ out.begin() };
+    for (const std::size_t index : indexes)
+        *out_it++ = population[index];
+}
+
 //---------------------------------------------------------------------------
 /** Chooses k unique random elements from a population sequence (std::vector<>, with counts vector). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename C>
     requires std::is_integral_v<C>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::sample(
     std::vector<T>& out,
     const std::vector<T>& population,
     const std::vector<C>& counts,
@@ -1489,70 +1922,111 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::sample(
     if (population.size() != counts.size())
         throw SampleSizesException(population.size(), counts.size());
 
-    const std::size_t samples_count = std::size_t(std::accumulate(counts.cbegin(), counts.cend(), C(0)));
+    const std::uint64_t samples_count{ _counts_total<C>(counts) };
     if (k > samples_count)
         throw SampleCountException(k, samples_count);
 
-    std::vector<T> samples(samples_count);
-    auto c_it = counts.cbegin();
-    auto s_it = samples.begin();
-    for (auto& p : population) {
-        for (std::size_t j = std::size_t(*c_it++); j > 0; --j)
-            *s_it++ = p;
+    out.clear();
+    if constexpr (std::is_same_v<T, bool>) {
+        // notice: std::vector<bool> cannot be viewed as a span, the elements are appended one by one
+        utils::FenwickTree<std::uint64_t> counts_tree(counts);
+        std::uint64_t remaining_count{ samples_count };
+
+        out.reserve(k);
+        for (std::size_t i = 0; i < k; ++i) {
+            const std::size_t index{ counts_tree.find(uniform<std::uint64_t>(remaining_count--)) };
+            out.push_back(population[index]);
+            counts_tree.decrease(index, 1);
+        }
     }
+    else {
+        out.resize(k);
+        _sample_counts<T, C>(out, population, counts);
+    }
+}
 
-    out.clear();
-    out.resize(k);
-    auto out_it{ out.begin() };
-    for (std::size_t i = 0; i < k; ++i) {
-        const std::size_t index = uniform<std::size_t>(i, samples_count);
-        *out_it++ = samples[index];
-        if (i != index)
-            std::swap(samples[i], samples[index]);
+//---------------------------------------------------------------------------
+/** Returns the sum of the counts of elements, checking that none is negative. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+template<typename C>
+    requires std::is_integral_v<C>
+const std::uint64_t BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_counts_total(std::span<const C> counts)
+{
+    std::uint64_t total{ 0 };
+    for (const C c : counts) {
+        if constexpr (std::is_signed_v<C>) {
+            if (c < 0)
+                throw PositiveValueException(c);
+        }
+        total += std::uint64_t(c);
+    }
+    return total;
+}
+
+//---------------------------------------------------------------------------
+/** Chooses unique random elements from a population with counts, as many as the out span contains. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+template<typename T, typename C>
+    requires std::is_integral_v<C>
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_sample_counts(
+    std::span<T> out,
+    std::span<const T> population,
+    std::span<const C> counts
+)
+{
+    utils::FenwickTree<std::uint64_t> counts_tree(counts);
+    std::uint64_t samples_count{ counts_tree.total() };
+
+    for (T& o : out) {
+        const std::size_t index{ counts_tree.find(uniform<std::uint64_t>(samples_count--)) };
+        o = population[index];
+        counts_tree.decrease(index, 1);
     }
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed() noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed() noexcept
 {
     seed(utils::set_random_seed64());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits signed integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const int seed_) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const int seed_) noexcept
 {
     seed((const long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits unsigned integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned int seed_) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const unsigned int seed_) noexcept
 {
     seed((const unsigned long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits signed integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const long seed_) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const long seed_) noexcept
 {
     seed((const unsigned long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 32-bits unsigned integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long seed_) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const unsigned long seed_) noexcept
 {
     _setstate(seed_);
     _internal_state.gauss_valid = false;
@@ -1560,18 +2034,18 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long s
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 64-bits signed integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const long long seed_) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const long long seed_) noexcept
 {
     seed((const unsigned long long)seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state from a 64-bits unsigned integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long long seed_) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     _setstate(seed_);
     _internal_state.gauss_valid = false;
@@ -1579,9 +2053,9 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const unsigned long l
 
 //---------------------------------------------------------------------------
 /** Initializes the internal state of this PRNG with a 128-bits integer seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const utils::UInt128& seed_) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     _setstate(seed_);
     _internal_state.gauss_valid = false;
@@ -1589,9 +2063,9 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const utils::UInt128&
 
 //---------------------------------------------------------------------------
 /** ief Initalizes internal state from a double seed. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const double seed_)
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::seed(const double seed_)
 {
     if (0.0 <= seed_ && seed_ <= 1.0)
         seed(std::uint64_t(seed_ * double(0xffff'ffff'ffff'ffffULL)));
@@ -1601,18 +2075,18 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::seed(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Restores internal state from object returned by getstate(). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const struct _InternalState& new_internal_state) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::setstate(const struct _InternalState& new_internal_state) noexcept
 {
     _internal_state = new_internal_state;
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state from a new internal state content. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new_internal_state) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::setstate(const StateT& new_internal_state) noexcept
 {
     _internal_state.state = new_internal_state;
     _internal_state.gauss_next = 0.0;
@@ -1621,9 +2095,9 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new
 
 //---------------------------------------------------------------------------
 /** Sets the internal state from a new internal state content and gauss_next. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new_internal_state, const double gauss_next) noexcept
+inline void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::setstate(const StateT& new_internal_state, const double gauss_next) noexcept
 {
     _internal_state.state = new_internal_state;
     _internal_state.gauss_next = gauss_next;
@@ -1632,36 +2106,112 @@ inline void BaseRandom<StateT, OutputT, OUTPUT_BITS>::setstate(const StateT& new
 
 //---------------------------------------------------------------------------
 /** Returns the current internal state value. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline const StateT BaseRandom<StateT, OutputT, OUTPUT_BITS>::state() const noexcept
+inline const StateT BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::state() const noexcept
 {
     return _internal_state.state;
 }
 
 //---------------------------------------------------------------------------
 /** Shuffles specified sequence in place. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename ContainerType>
-    requires utils::is_indexable_v<ContainerType>
-void BaseRandom<StateT, OutputT, OUTPUT_BITS>::shuffle(ContainerType& seq)
+    requires std::ranges::random_access_range<ContainerType> && std::ranges::sized_range<ContainerType>
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::shuffle(ContainerType&& seq)
 {
-    const std::size_t n{ seq.size() };
+    const std::size_t n{ std::size_t(std::ranges::size(seq)) };
+    auto first{ std::ranges::begin(seq) };
 
     if (n != 0) {
         for (std::size_t i = 0; i < n - 1; ++i) {
             const std::size_t index = uniform<std::size_t>(i, n);
-            std::swap(seq[i], seq[index]);
+            std::ranges::iter_swap(first + i, first + index);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------
+/** In place shuffles the specified sequence with parallel workers. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+template<typename ContainerType>
+    requires std::ranges::random_access_range<ContainerType> && std::ranges::sized_range<ContainerType> &&
+             std::default_initializable<std::ranges::range_value_t<ContainerType>> && (!std::is_void_v<EngineT>)
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::shuffle(ContainerType&& seq, const std::size_t workers_count)
+{
+    const std::size_t n{ std::size_t(std::ranges::size(seq)) };
+    const std::size_t w_count{ utils::parallel_workers_count(n, workers_count) };
+    if (w_count == 1) {
+        shuffle(seq);
+        return;
+    }
+
+    auto first{ std::ranges::begin(seq) };
+
+    // one independent substream per worker, seeded from this PRNG
+    std::vector<EngineT> substreams;
+    substreams.reserve(w_count);
+    for (std::size_t w = 0; w < w_count; ++w)
+        substreams.emplace_back(static_cast<unsigned long long>(_random_bits64()));
+
+    auto chunk_begin = [n, w_count](const std::size_t w) { return utils::chunk_begin(n, w_count, w); };
+
+    // 1st pass: each worker counts the elements of its chunk that go to each bucket - notice: on a copy of its substream
+    std::vector<std::size_t> counts(w_count * w_count, 0);  // notice: w_count buckets per worker
+    utils::run_workers(w_count,
+        [&](const std::size_t w) {
+            EngineT substream{ substreams[w] };
+            std::size_t* w_counts{ counts.data() + w * w_count };
+            for (std::size_t i = chunk_begin(w); i < chunk_begin(w + 1); ++i)
+                ++w_counts[substream.template uniform<std::size_t>(w_count)];
+        }
+    );
+
+    // evaluates the position of each worker in each bucket, buckets being contiguous
+    std::vector<std::size_t> positions(w_count * w_count);
+    std::vector<std::size_t> buckets_begin(w_count + 1);
+    std::size_t position{ 0 };
+    for (std::size_t b = 0; b < w_count; ++b) {
+        buckets_begin[b] = position;
+        for (std::size_t w = 0; w < w_count; ++w) {
+            positions[w * w_count + b] = position;
+            position += counts[w * w_count + b];
         }
     }
+    buckets_begin[w_count] = n;
+
+    // 2nd pass: each worker scatters its chunk to the buckets, replaying the same draws
+    std::vector<std::ranges::range_value_t<ContainerType>> buffer(n);
+    utils::run_workers(w_count,
+        [&](const std::size_t w) {
+            EngineT& substream{ substreams[w] };
+            std::size_t* w_positions{ positions.data() + w * w_count };
+            for (std::size_t i = chunk_begin(w); i < chunk_begin(w + 1); ++i)
+                buffer[w_positions[substream.template uniform<std::size_t>(w_count)]++] = std::move(first[i]);
+        }
+    );
+
+    // 3rd pass: each worker shuffles one bucket and moves it back into the sequence
+    utils::run_workers(w_count,
+        [&](const std::size_t b) {
+            EngineT& substream{ substreams[b] };
+            const std::size_t b_begin{ buckets_begin[b] };
+            const std::size_t b_size{ buckets_begin[b + 1] - b_begin };
+            auto b_first{ buffer.begin() + b_begin };
+            for (std::size_t i = 0; i + 1 < b_size; ++i)
+                std::iter_swap(b_first + i, b_first + substream.template uniform<std::size_t>(i, b_size));
+            std::move(b_first, b_first + b_size, first + b_begin);
+        }
+    );
 }
 
 //---------------------------------------------------------------------------
 /** Beta distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::betavariate(const double alpha, const double beta)
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::betavariate(const double alpha, const double beta)
 {
     if (alpha <= 0.0 || beta <= 0.0)
         throw AlphaBetaArgsException(alpha, beta);
@@ -1672,102 +2222,69 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::betavariate(const double
 
 //---------------------------------------------------------------------------
 /** Exponential distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::expovariate(const double lambda)
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::expovariate(const double lambda)
 {
     if (lambda <= 0.0)
         throw ExponentialZeroLambdaException();
 
-    const double u{ uniform() };
-    if (u < 1.0)  // should always happen, let's check for it nevertheless
-        return -std::log(1.0 - u) / lambda;
-    else
-        return 0.0;
+    return _expo_ziggurat() / lambda;
 }
 
 //---------------------------------------------------------------------------
 /** Gamma distribution. This is NOT the gamma function! */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gammavariate(const double alpha, const double beta)
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gammavariate(const double alpha, const double beta)
 {
-    constexpr int N_MAX_LOOPS{ 10 };
-    int n_loops{ 0 };
-
     if (alpha <= 0.0 || beta <= 0.0)
         throw AlphaBetaArgsException(alpha, beta);
 
-    if (alpha > 1.0) {
-        // Uses R.C.H.Cheng paper
-        // "The generation of Gamma variables with non - integral shape parameters",
-        // Applied Statistics, (1977), 26, No. 1, p71 - 74
-        // (modified here with n_loops testing against max loops count and with default returned value)
-        constexpr double EPSILON{ 1e-7 };
-        const double     INV_A{ std::sqrt(2.0 * alpha - 1.0) };
-        const double     B{ alpha - LOG4 };
-        const double     C{ alpha + INV_A };
-
-        double u1;
-        while (n_loops < N_MAX_LOOPS) {  // Notice: while (true) in initial Cheng's algorithm
-            u1 = std::min(uniform(), 1.0 - EPSILON);  // Notice: modification from initial algorithm u1 is always less than 1-epsilon
-            if (EPSILON < u1) {          // Notice: modification from initial algorithm, removed the test u1 < 1-epsilon
-                const double u2{ 1.0 - uniform() };
-                const double v{ std::log(u1 / (1.0 - u1)) / INV_A };
-                const double x{ alpha - std::exp(v) };
-                const double z{ u1 * u1 * u2 };
-                const double r{ B + C * v - x };
-                if (r + SG_MAGICCONST - 4.5 * z >= 0.0 || r >= std::log(z))
-                    // this should eventually happen
-                    return x < 0 ? -x * beta : x * beta;
-            }
-            ++n_loops;
-        }
-        // added to initial algorithm : u1 < EPSILON happened too many successive times
-        return 0.0;
-    }
-    else if (alpha == 1.0) {
+    if (alpha == 1.0) {
         // this is exponential distribution with lambda = 1 / beta
-        return -std::log(1.0 - uniform()) * beta;
+        return _expo_ziggurat() * beta;
+    }
+    else if (alpha < 1.0) {
+        // boosts alpha, see Marsaglia and Tsang's paper below: G(alpha) = G(alpha + 1) * u^(1 / alpha)
+        return gammavariate(alpha + 1.0, beta) * std::pow(1.0 - uniform(), 1.0 / alpha);
     }
     else {
-        // alpha is between 0 and 1 (exclusive)
-        // so, uses ALGORITHM GS of Statistical Computing - Kennedy & Gentle
-        double b, p, x, u;
-        while (n_loops < N_MAX_LOOPS) {  // Notice: while (true) in initial Kennedy & Gentle's algorithm
-            u = uniform();
-            b = (E + alpha) / E;
-            p = b * u;
-            x = p <= 1.0 ? std::pow(p, 1.0 / alpha) : -std::log((b - p) / alpha);
-            u = uniform();
-            if (p <= 1.0) {
-                if (u <= std::exp(-x))
-                    return x * beta;
+        // Uses G. Marsaglia and W. W. Tsang paper
+        // "A Simple Method for Generating Gamma Variables",
+        // ACM Transactions on Mathematical Software, (2000), 26, No. 3, p363 - 372
+        const double d{ alpha - 1.0 / 3.0 };
+        const double c{ 1.0 / std::sqrt(9.0 * d) };
+
+        while (true) {
+            const double x{ gauss_ziggurat() };
+            double v{ 1.0 + c * x };
+            if (v > 0.0) {
+                v = v * v * v;
+                const double u{ uniform() };
+                const double x2{ x * x };
+                if (u < 1.0 - 0.0331 * x2 * x2 || std::log(u) < 0.5 * x2 + d * (1.0 - v + std::log(v)))
+                    // this should happen in about 98% of the cases at first loop
+                    return d * v * beta;
             }
-            else if (u <= std::pow(x, alpha - 1.0))
-                return x * beta;
-
-            ++n_loops;  // added to initial algorithm
         }
-        // added to initial algorithm
-        return beta * -std::log(b - p) / alpha;
     }
 }
 
 //---------------------------------------------------------------------------
 /** Default Gaussian distribution (mean=0.0, stdev=1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gauss() noexcept
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss() noexcept
 {
     return gauss(0.0, 1.0);
 }
 
 //---------------------------------------------------------------------------
 /** Gaussian distribution (mean=mu, stdev=sigma). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gauss(const double mu, const double sigma)
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss(const double mu, const double sigma)
 {
     if (sigma <= 0.0)
         throw GaussSigmaException(sigma);
@@ -1788,38 +2305,201 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::gauss(const double mu, co
     return mu + z * sigma;
 }
 
+//---------------------------------------------------------------------------
+/** Fills a span with Gaussian values (mean=mu, stdev=sigma). */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss(std::span<double> values, const double mu, const double sigma)
+{
+    if (sigma <= 0.0)
+        throw GaussSigmaException(sigma);
+
+    constexpr std::size_t BLOCK_SIZE{ 128 };  // count of pairs per block
+    double radius[BLOCK_SIZE], angle[BLOCK_SIZE];
+
+    double* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::size_t pairs_count{ std::min(BLOCK_SIZE, (remaining + 1) / 2) };
+
+        // draws all the uniform values of the block first
+        for (std::size_t i = 0; i < pairs_count; ++i) {
+            radius[i] = 1.0 - random();
+            angle[i] = TWO_PI * random();
+        }
+
+        // then evaluates the Gaussian values, with one transcendental function per loop so that each loop gets vectorized
+        for (std::size_t i = 0; i < pairs_count; ++i)
+            radius[i] = std::sqrt(-2.0 * std::log(radius[i])) * sigma;
+        for (std::size_t i = 0; i < pairs_count; ++i)
+            out[2 * i] = mu + std::cos(angle[i]) * radius[i];
+        const std::size_t full_pairs{ std::min(pairs_count, remaining / 2) };  // notice: the last value of an odd-sized span is a cosine one
+        for (std::size_t i = 0; i < full_pairs; ++i)
+            out[2 * i + 1] = mu + std::sin(angle[i]) * radius[i];
+
+        const std::size_t done{ std::min(remaining, 2 * pairs_count) };
+        out += done;
+        remaining -= done;
+    }
+}
+
+//---------------------------------------------------------------------------
+/** Fills a span with Gaussian values (mean=mu, stdev=sigma), simple precision version. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+void BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss(std::span<float> values, const float mu, const float sigma)
+{
+    if (sigma <= 0.0f)
+        throw GaussSigmaException(double(sigma));
+
+    constexpr std::size_t BLOCK_SIZE{ 128 };  // count of pairs per block
+    constexpr float TWO_PI_F{ float(TWO_PI) };
+    float radius[BLOCK_SIZE], angle[BLOCK_SIZE];
+
+    float* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::size_t pairs_count{ std::min(BLOCK_SIZE, (remaining + 1) / 2) };
+
+        // draws all the uniform values of the block first
+        for (std::size_t i = 0; i < pairs_count; ++i) {
+            radius[i] = float(1.0 - random());  // notice: never rounded to 0.0f since 1.0 - random() >= 2^-53
+            angle[i] = TWO_PI_F * float(random());
+        }
+
+        // then evaluates the Gaussian values, with one transcendental function per loop so that each loop gets vectorized
+        for (std::size_t i = 0; i < pairs_count; ++i)
+            radius[i] = std::sqrt(-2.0f * std::log(radius[i])) * sigma;
+        for (std::size_t i = 0; i < pairs_count; ++i)
+            out[2 * i] = mu + std::cos(angle[i]) * radius[i];
+        const std::size_t full_pairs{ std::min(pairs_count, remaining / 2) };  // notice: the last value of an odd-sized span is a cosine one
+        for (std::size_t i = 0; i < full_pairs; ++i)
+            out[2 * i + 1] = mu + std::sin(angle[i]) * radius[i];
+
+        const std::size_t done{ std::min(remaining, 2 * pairs_count) };
+        out += done;
+        remaining -= done;
+    }
+}
+
+//---------------------------------------------------------------------------
+/** Default Gaussian distribution (mean=0.0, stdev=1.0), ziggurat method. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss_ziggurat() noexcept
+{
+    using namespace utils::ziggurat;
+
+    constexpr int N_MAX_LOOPS{ 10 };
+    int n_loops{ 0 };
+
+    double x{ 0.0 };
+    while (n_loops++ < N_MAX_LOOPS) {
+        // 8 most significant bits for the layer index, next bit for the sign, 52 next bits for the abscissa
+        const std::uint64_t r{ _random_bits64() };
+        const std::uint32_t i{ std::uint32_t(r >> 56) };
+        const bool negative{ ((r >> 55) & 1) != 0 };
+        const std::uint64_t rabs{ (r >> 3) & 0x000f'ffff'ffff'ffffull };
+
+        x = double(rabs) * NORMAL_W[i];
+        if (negative)
+            x = -x;
+
+        if (rabs < NORMAL_K[i])
+            return x;  // notice: about 99% of the cases
+
+        if (i == 0) {
+            // the tail of the distribution, beyond NORMAL_R
+            for (int n = 0; n < N_MAX_LOOPS; ++n) {
+                const double xx{ -NORMAL_INV_R * std::log1p(-random()) };
+                const double yy{ -std::log1p(-random()) };
+                if (yy + yy > xx * xx)
+                    return negative ? -(NORMAL_R + xx) : NORMAL_R + xx;
+            }
+        }
+        else if ((NORMAL_F[i - 1] - NORMAL_F[i]) * random() + NORMAL_F[i] < std::exp(-0.5 * x * x))
+            return x;
+    }
+
+    return x;  // notice: should happen in very rare cases
+}
+
+//---------------------------------------------------------------------------
+/** Gaussian distribution (mean=mu, stdev=sigma), ziggurat method. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::gauss_ziggurat(const double mu, const double sigma)
+{
+    if (sigma <= 0.0)
+        throw GaussSigmaException(sigma);
+
+    return mu + gauss_ziggurat() * sigma;
+}
+
+//---------------------------------------------------------------------------
+/** Exponential distribution (lambda=1.0), ziggurat method. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_expo_ziggurat() noexcept
+{
+    using namespace utils::ziggurat;
+
+    constexpr int N_MAX_LOOPS{ 10 };
+    int n_loops{ 0 };
+
+    double x{ 0.0 };
+    while (n_loops++ < N_MAX_LOOPS) {
+        // 8 most significant bits for the layer index, 53 next bits for the abscissa
+        const std::uint64_t r{ _random_bits64() };
+        const std::uint32_t i{ std::uint32_t(r >> 56) };
+        const std::uint64_t rabs{ (r >> 3) & 0x001f'ffff'ffff'ffffull };
+
+        x = double(rabs) * EXPO_W[i];
+
+        if (rabs < EXPO_K[i])
+            return x;  // notice: about 99% of the cases
+
+        if (i == 0)
+            return EXPO_R - std::log1p(-random());  // the tail of the distribution, beyond EXPO_R - notice: exponential distribution is memoryless
+        else if ((EXPO_F[i - 1] - EXPO_F[i]) * random() + EXPO_F[i] < std::exp(-x))
+            return x;
+    }
+
+    return x;  // notice: should happen in very rare cases
+}
+
 //---------------------------------------------------------------------------
 /** Default Log normal distribution (mean=0.0, stdev=1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::lognormvariate()
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::lognormvariate()
 {
     return lognormvariate(0.0, 1.0);
 }
 
 //---------------------------------------------------------------------------
 /** Log normal distribution (mean=mu, stdev=sigma). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::lognormvariate(const double mu, const double sigma)
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::lognormvariate(const double mu, const double sigma)
 {
     return std::exp(normalvariate(mu, sigma));
 }
 
 //---------------------------------------------------------------------------
 /** Normal distribution (mean=0.0, stdev=1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::normalvariate()
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::normalvariate()
 {
     return normalvariate(0.0, 1.0);
 }
 
 //---------------------------------------------------------------------------
 /** Normal distribution (mean=mu, stdev=sigma). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::normalvariate(const double mu, const double sigma)
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::normalvariate(const double mu, const double sigma)
 {
     if (sigma <= 0.0)
         throw NormalSigmaException();
@@ -1843,40 +2523,40 @@ inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::normalvariate(cons
 
 //---------------------------------------------------------------------------
 /** Pareto distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::paretovariate(const double alpha)
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::paretovariate(const double alpha)
 {
     if (alpha == 0.0)
         throw ParetoArgsValueException();
 
-    // according to Jain, pg. 495
-    return std::pow(1.0 - uniform(), -1.0 / alpha);
+    // according to Jain, pg. 495, i.e. (1 - u)^(-1/alpha) with -log(1 - u) exponentially distributed
+    return std::exp(_expo_ziggurat() / alpha);
 }
 
 //---------------------------------------------------------------------------
 /** Triangular distribution (low=0.0, high=1.0, mode=0.5). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular() noexcept
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::triangular() noexcept
 {
     return triangular(0.0, 1.0, 0.5);
 }
 
 //---------------------------------------------------------------------------
 /** Triangular distribution (low, high, default mode). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular(const double low, const double high) noexcept
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::triangular(const double low, const double high) noexcept
 {
     return triangular(low, high, (low + high) / 2);
 }
 
 //---------------------------------------------------------------------------
 /** Triangular distribution (low, high, mode). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular(double low, double high, const double mode) noexcept
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::triangular(double low, double high, const double mode) noexcept
 {
     if (high == low)
         return high;
@@ -1891,51 +2571,80 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::triangular(double low, do
 
 //---------------------------------------------------------------------------
 /** Uniform distribution in [0.0, 1.0). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T>
     requires std::is_floating_point_v<T>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform() noexcept
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::uniform() noexcept
 {
     return random<T>();
 }
 
 //---------------------------------------------------------------------------
 /** Uniform distribution in [0.0, max). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename U>
     requires std::is_arithmetic_v<T> && std::is_arithmetic_v<U>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform(const U max) noexcept
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::uniform(const U max) noexcept
 {
-    if (max >= U(0))
-        return T(std::min<long double>((long double)max * random<long double>(), (long double)(max - 1e-7L)));
-    else
-        return T(std::max<long double>((long double)max * random<long double>(), (long double)(max - 1e-7L)));
+    if constexpr (std::is_integral_v<T> && std::is_integral_v<U>) {
+        using R = std::conditional_t<(sizeof(U) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>;
+
+        if constexpr (std::is_unsigned_v<U>)
+            return T(_bounded<R>(R(max)));
+        else if (max >= U(0))
+            return T(_bounded<R>(R(max)));
+        else
+            return T(-std::make_signed_t<R>(_bounded<R>(R(0) - R(max))));
+    }
+    else {
+        // notice: long double arithmetic is used only when explicitly asked for by caller
+        using F = std::conditional_t<std::is_floating_point_v<T>, std::common_type_t<T, U>, std::common_type_t<double, U>>;
+
+        if (max >= U(0))
+            return T(std::min<F>(F(max) * random<F>(), F(max) - F(1e-7)));
+        else
+            return T(std::max<F>(F(max) * random<F>(), F(max) - F(1e-7)));
+    }
 }
 
 
 //---------------------------------------------------------------------------
 /** Uniform distribution in [min, max). */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
 template<typename T, typename U, typename V>
     requires std::is_arithmetic_v<T> && std::is_arithmetic_v<U> && std::is_arithmetic_v<V>
-inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS>::uniform(const U min, const V max) noexcept
+inline const T BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::uniform(const U min, const V max) noexcept
 {
-    const long double a{ (long double)min };
-    const long double b{ (long double)max };
-    if (a <= b)
-        return T(a + (b - a) * random<long double>());
-    else
-        return T(b + (a - b) * random<long double>());
+    if constexpr (std::is_integral_v<T> && std::is_integral_v<U> && std::is_integral_v<V>) {
+        using R = std::conditional_t<(sizeof(U) <= sizeof(std::uint32_t) && sizeof(V) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>;
+
+        // notice: modulo arithmetic on unsigned type R, no overflow can happen
+        if (std::cmp_less_equal(min, max))
+            return T(R(min) + _bounded<R>(R(max) - R(min)));
+        else
+            return T(R(max) + _bounded<R>(R(min) - R(max)));
+    }
+    else {
+        // notice: long double arithmetic is used only when explicitly asked for by caller
+        using F = std::conditional_t<std::is_floating_point_v<T>, std::common_type_t<T, U, V>, std::common_type_t<double, U, V>>;
+
+        const F a{ F(min) };
+        const F b{ F(max) };
+        if (a <= b)
+            return T(a + (b - a) * random<F>());
+        else
+            return T(b + (a - b) * random<F>());
+    }
 }
 
 //---------------------------------------------------------------------------
 /** Circular data distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::vonmisesvariate(const double mu, const double kappa)
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::vonmisesvariate(const double mu, const double kappa)
 {
     // extracted from Python 3.11 comments:
     // Based upon an algorithm published in : Fisher, N.I.,
@@ -1984,14 +2693,192 @@ const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::vonmisesvariate(const dou
 
 //---------------------------------------------------------------------------
 /** Weibull distribution. */
-template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS>
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
     requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
-const double BaseRandom<StateT, OutputT, OUTPUT_BITS>::weibullvariate(const double alpha, const double beta)
+const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::weibullvariate(const double alpha, const double beta)
 {
     if (alpha < 0.0 || beta <= 0.0)
         throw WeibullArgsValueException();
 
-    return alpha * std::pow(-std::log(1.0 - uniform()), 1.0 / beta);
+    if (beta == 1.0)
+        return alpha * _expo_ziggurat();  // notice: this is exponential distribution with lambda = 1 / alpha
+    else
+        return alpha * std::pow(_expo_ziggurat(), 1.0 / beta);
+}
+
+//---------------------------------------------------------------------------
+/** Returns an unbiased uniform integer value in range [0, range). */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+template<typename R>
+    requires std::is_unsigned_v<R>
+inline const R BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_bounded(const R range) noexcept
+{
+    if constexpr (sizeof(R) <= sizeof(std::uint32_t)) {
+        return R(_bounded32(std::uint32_t(range)));
+    }
+    else {
+        if (range <= R(0xffff'ffffull))
+            return R(_bounded32(std::uint32_t(range)));  // notice: cheaper, and a single call to next() with 32-bits PRNGs
+        else if constexpr (std::is_same_v<OutputT, utils::UInt128>)
+            return R(_bounded128(std::uint64_t(range)));
+        else
+            return R(_bounded64(std::uint64_t(range)));
+    }
+}
+
+//---------------------------------------------------------------------------
+/** 32-bits ranges, Lemire's method. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const std::uint32_t BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_bounded32(const std::uint32_t range) noexcept
+{
+    constexpr int N_MAX_LOOPS{ 10 };
+
+    std::uint64_t m{ std::uint64_t(_random_bits32()) * range };
+    if (std::uint32_t(m) < range) {
+        const std::uint32_t threshold{ (0u - range) % range };  // i.e. 2^32 mod range
+        int n_loops{ 0 };
+        while (std::uint32_t(m) < threshold && n_loops++ < N_MAX_LOOPS)  // notice: modification from initial algorithm, avoids infinite looping with degenerated PRNGs
+            m = std::uint64_t(_random_bits32()) * range;
+    }
+
+    return std::uint32_t(m >> 32);
+}
+
+//---------------------------------------------------------------------------
+/** 64-bits ranges, Lemire's method. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const std::uint64_t BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_bounded64(const std::uint64_t range) noexcept
+{
+    constexpr int N_MAX_LOOPS{ 10 };
+
+    utils::UInt128 m{ _random_bits64() };
+    m *= range;
+    if (m.lo < range) {
+        const std::uint64_t threshold{ (0ull - range) % range };  // i.e. 2^64 mod range
+        int n_loops{ 0 };
+        while (m.lo < threshold && n_loops++ < N_MAX_LOOPS) {  // notice: modification from initial algorithm, avoids infinite looping with degenerated PRNGs
+            m = _random_bits64();
+            m *= range;
+        }
+    }
+
+    return m.hi;
+}
+
+//---------------------------------------------------------------------------
+/** 64-bits ranges with 128-bits outputs, Lemire's method. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const std::uint64_t BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_bounded128(const std::uint64_t range) noexcept
+{
+    constexpr int N_MAX_LOOPS{ 10 };
+
+    // evaluates the 192-bits product of a 128-bits random value by range:
+    // high gets its bits 128 to 191, mid and low get its bits 64 to 127 and 0 to 63
+    std::uint64_t high, mid, low;
+    auto product = [&]() {
+        const utils::UInt128 x{ _next() };
+        utils::UInt128 p_lo{ x.lo };
+        utils::UInt128 p_hi{ x.hi };
+        p_lo *= range;
+        p_hi *= range;
+        low = p_lo.lo;
+        mid = p_lo.hi + p_hi.lo;
+        high = p_hi.hi + (mid < p_lo.hi ? 1 : 0);
+    };
+
+    product();
+    if (mid == 0 && low < range) {
+        // evaluates 2^128 mod range by doubling 2^64 mod range 64 times
+        std::uint64_t threshold{ (0ull - range) % range };
+        for (int i = 0; i < 64; ++i)
+            threshold = (threshold >= range - threshold) ? threshold - (range - threshold) : threshold << 1;
+
+        int n_loops{ 0 };
+        while (mid == 0 && low < threshold && n_loops++ < N_MAX_LOOPS)  // notice: modification from initial algorithm, avoids infinite looping with degenerated PRNGs
+            product();
+    }
+
+    return high;
+}
+
+//---------------------------------------------------------------------------
+/** Returns 32 random bits, from the most significant ones of the internal PRNG outputs. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const std::uint32_t BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_random_bits32() noexcept
+{
+    if constexpr (std::is_same_v<OutputT, utils::UInt128>) {
+        return std::uint32_t(_next().hi >> 32);
+    }
+    else if constexpr (OUTPUT_BITS >= 32) {
+        return std::uint32_t(_next() >> (OUTPUT_BITS - 32));
+    }
+    else {
+        // notice: full outputs first, then the missing bits from the most significant ones of a last output
+        std::uint32_t bits{ 0 };
+        int n{ 0 };
+        for (; n + OUTPUT_BITS <= 32; n += OUTPUT_BITS)
+            bits = (bits << OUTPUT_BITS) | std::uint32_t(_next());
+        if (n < 32)
+            bits = (bits << (32 - n)) | std::uint32_t(_next() >> (OUTPUT_BITS - (32 - n)));
+        return bits;
+    }
+}
+
+//---------------------------------------------------------------------------
+/** Returns 64 random bits, from the most significant ones of the internal PRNG outputs. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const std::uint64_t BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_random_bits64() noexcept
+{
+    if constexpr (std::is_same_v<OutputT, utils::UInt128>) {
+        return _next().hi;
+    }
+    else if constexpr (OUTPUT_BITS >= 64) {
+        return std::uint64_t(_next());
+    }
+    else {
+        // notice: full outputs first, then the missing bits from the most significant ones of a last output
+        std::uint64_t bits{ 0 };
+        int n{ 0 };
+        for (; n + OUTPUT_BITS <= 64; n += OUTPUT_BITS)
+            bits = (bits << OUTPUT_BITS) | std::uint64_t(_next());
+        if (n < 64)
+            bits = (bits << (64 - n)) | (std::uint64_t(_next()) >> (OUTPUT_BITS - (64 - n)));
+        return bits;
+    }
+}
+
+//---------------------------------------------------------------------------
+/** Returns a float value in [0.0, 1.0), built from the 24 most significant bits of the internal PRNG outputs. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const float BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_random_float() noexcept
+{
+    if constexpr (std::is_same_v<OutputT, utils::UInt128>)
+        return float(std::uint32_t(_next().hi >> 40)) * _NORMALIZE_24;
+    else if constexpr (OUTPUT_BITS > 24)
+        return float(std::uint32_t(_next() >> (OUTPUT_BITS - 24))) * _NORMALIZE_24;
+    else
+        return float(_next()) * float(_NORMALIZE);  // notice: exact conversion of outputs
+}
+
+//---------------------------------------------------------------------------
+/** Returns a double value in [0.0, 1.0), built from the 53 most significant bits of the internal PRNG outputs. */
+template<typename StateT, typename OutputT, const std::uint8_t OUTPUT_BITS, typename EngineT>
+    requires std::is_integral_v<OutputT> || std::is_same_v<OutputT, utils::UInt128>
+inline const double BaseRandom<StateT, OutputT, OUTPUT_BITS, EngineT>::_random_double() noexcept
+{
+    if constexpr (std::is_same_v<OutputT, utils::UInt128>)
+        return double(_next().hi >> 11) * _NORMALIZE_53;
+    else if constexpr (OUTPUT_BITS > 53)
+        return double(std::uint64_t(_next()) >> (OUTPUT_BITS - 53)) * _NORMALIZE_53;
+    else
+        return double(_next()) * _NORMALIZE;  // notice: exact conversion of outputs
 }
 
 /** @}*/
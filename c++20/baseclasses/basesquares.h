@@ -44,9 +44,11 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <span>
 
 #include "baserandom.h"
 #include "../internalstates/counterkeystate.h"
+#include "../utils/parallel_chunks.h"
 #include "../utils/uint128.h"
 
 
@@ -107,12 +109,12 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-template<typename OutputT>
-class BaseSquares : public BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT)>
+template<typename OutputT, typename EngineT = void>
+class BaseSquares : public BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT), EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT)>;
+    using MyBaseClass = BaseRandom<CounterKeyState, OutputT, 8 * sizeof(OutputT), EngineT>;
     using output_type = OutputT;
     using state_type = MyBaseClass::state_type;
     using value_type = typename state_type::value_type;
@@ -150,6 +152,21 @@ public:
     virtual inline void _setstate(const std::uint64_t   seed) noexcept override;    //!< Sets the internal state of this PRNG with a 64-bits integer seed.
     virtual inline void _setstate(const utils::UInt128& seed) noexcept override;    //!< Sets the internal state of this PRNG with a 128-bits integer seed.
 
+    void inline discard(const std::uint64_t n) noexcept;            //!< Advances the counter as if n outputs had been drawn, in O(1) time.
+
+
+protected:
+    /** @brief Fills values with the outputs for counters first_counter, first_counter+1, ..., with parallel workers.
+    *
+    * values is split in as many contiguous chunks as there are workers, and
+    * each worker calls fill_lanes(counter, out, count) on its own chunk,  with
+    * counter being the one that precedes the first counter of the chunk. The
+    * filled values are then the same whatever the count of workers. Spans with
+    * less than 65,536 values per worker are filled sequentially.
+    */
+    template<typename FillLanesT>
+    static void _fill_parallel(std::span<OutputT> values, const value_type first_counter, const std::size_t workers_count, FillLanesT&& fill_lanes);
+
 };
 
 
@@ -157,8 +174,8 @@ public:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares() noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares() noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed();
@@ -166,8 +183,8 @@ inline BaseSquares<OutputT>::BaseSquares() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -175,8 +192,8 @@ inline BaseSquares<OutputT>::BaseSquares(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const unsigned int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -184,8 +201,8 @@ inline BaseSquares<OutputT>::BaseSquares(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -193,8 +210,8 @@ inline BaseSquares<OutputT>::BaseSquares(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const unsigned long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -202,8 +219,8 @@ inline BaseSquares<OutputT>::BaseSquares(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -211,8 +228,8 @@ inline BaseSquares<OutputT>::BaseSquares(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const unsigned long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -220,8 +237,8 @@ inline BaseSquares<OutputT>::BaseSquares(const unsigned long long seed_) noexcep
 
 //---------------------------------------------------------------------------
 /** Valued constructor (unsigned 128-bits). */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const utils::UInt128& seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -229,8 +246,8 @@ inline BaseSquares<OutputT>::BaseSquares(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const double seed_)
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -238,8 +255,8 @@ inline BaseSquares<OutputT>::BaseSquares(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<typename OutputT>
-inline BaseSquares<OutputT>::BaseSquares(const state_type& internal_state) noexcept
+template<typename OutputT, typename EngineT>
+inline BaseSquares<OutputT, EngineT>::BaseSquares(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -247,80 +264,80 @@ inline BaseSquares<OutputT>::BaseSquares(const state_type& internal_state) noexc
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed() noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed() noexcept
 {
     _setstate(utils::set_random_seed64());
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const unsigned int seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const unsigned int seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const unsigned long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const unsigned long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const long long seed_) noexcept
 {
     MyBaseClass::seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const unsigned long long seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const utils::UInt128& seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::seed(const double seed_)
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::_setstate(const std::uint64_t seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);  // notice: the std::uint64_t specialization of this method is automatically called here
     MyBaseClass::_internal_state.state.counter = 0;
@@ -328,11 +345,37 @@ inline void BaseSquares<OutputT>::_setstate(const std::uint64_t seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<typename OutputT>
-inline void BaseSquares<OutputT>::_setstate(const utils::UInt128& seed_) noexcept
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
     MyBaseClass::_internal_state.state.counter = 0;
 }
 
+//---------------------------------------------------------------------------
+/** Advances the counter as if n outputs had been drawn, in O(1) time. */
+template<typename OutputT, typename EngineT>
+inline void BaseSquares<OutputT, EngineT>::discard(const std::uint64_t n) noexcept
+{
+    MyBaseClass::_internal_state.state.counter += n;  // notice: modulo 2^64 increment
+}
+
+//---------------------------------------------------------------------------
+/** Fills values with the outputs for counters first_counter, first_counter+1, ..., with parallel workers. */
+template<typename OutputT, typename EngineT>
+template<typename FillLanesT>
+void BaseSquares<OutputT, EngineT>::_fill_parallel(std::span<OutputT> values, const value_type first_counter, const std::size_t workers_count, FillLanesT&& fill_lanes)
+{
+    const std::size_t n{ values.size() };
+    const std::size_t w_count{ utils::parallel_workers_count(n, workers_count) };
+
+    utils::run_workers(w_count,
+        [&](const std::size_t w) {
+            const std::size_t begin{ utils::chunk_begin(n, w_count, w) };
+            const std::size_t end{ utils::chunk_begin(n, w_count, w + 1) };
+            fill_lanes(value_type(first_counter + begin - 1), values.data() + begin, end - begin);  // notice: modulo 2^64 counters
+        }
+    );
+}
+
 /** @}*/
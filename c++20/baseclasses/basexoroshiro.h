@@ -53,6 +53,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <array>
 #include <cstdint>
 
 #include "baserandom.h"
@@ -104,7 +105,8 @@ SOFTWARE.
 * @endcode
 *
 *   Inheriting classes have to define class attribute '_STATE_SIZE'. See Xoroshiro1024
-*   for an example.
+*   for an example. They also have to define class attribute '_JUMP_USES_INDEX', which
+*   tells jump() whether their algorithm uses the index of the internal list.
 *
 *   Reminder:
 *   We give you here below a copy of the table of tests for the xoroshiros  that  have
@@ -128,12 +130,12 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-template<const std::uint32_t SIZE>
-class BaseXoroshiro : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>
+template<const std::uint32_t SIZE, typename EngineT = void>
+class BaseXoroshiro : public BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64>;
+    using MyBaseClass = BaseRandom<ListSeedState<utils::SplitMix64, std::uint64_t, SIZE>, std::uint64_t, 64, EngineT>;
     using output_type = MyBaseClass::output_type;
     using state_type = MyBaseClass::state_type;
     using value_type = typename state_type::value_type;
@@ -171,6 +173,33 @@ public:
     virtual inline void _setstate(const std::uint64_t   seed) noexcept override;    //!< Sets the internal state of this PRNG with a 64-bits integer seed.
     virtual inline void _setstate(const utils::UInt128& seed) noexcept override;    //!< Sets the internal state of this PRNG with a 128-bits integer seed.
 
+
+    //---   Jumps   ---------------------------------------------------------
+    void inline jump() noexcept;                                        //!< Jumps ahead in the sequence of outputs (2^(32 x SIZE) steps).
+    void inline long_jump() noexcept;                                   //!< Jumps far ahead in the sequence of outputs (2^(48 x SIZE) steps).
+
+    /** @brief Jumps ahead in the sequence of outputs by the count of steps related to the specified polynomial.
+    *
+    * Bit b of word i in polynomial is the coefficient of x^(64 i + b).  The
+    * jump polynomial for n steps is x^n modulo the characteristic polynomial
+    * of the linear engine,  as  explained  by  D. Blackman  and  S. Vigna in
+    * [10] - see README.md. Polynomial x^n for n < 64 x SIZE is then a jump
+    * of n steps.
+    *
+    * The state is processed in a local copy,  rotated such that the current
+    * index is at position 0, and advanced with EngineT::_jump_step(),  i.e.
+    * without scrambling of any output. Each engine declares with its class
+    * attribute '_JUMP_USES_INDEX' whether its algorithm uses this  index.
+    * When it does not,  the internal list is never rotated,  whatever  the
+    * value of the index set with setstate(), and compilers then keep the
+    * whole local state in registers.
+    *
+    * Notice: the current index is kept unchanged, as in the reference code.
+    * With engines that use it, the internal list may then be  a  rotation
+    * of the one that n calls to next() would get, with the same next outputs.
+    */
+    void jump(const std::array<value_type, SIZE>& polynomial) noexcept;
+
 };
 
 
@@ -178,8 +207,8 @@ public:
 //---   TEMPLATES IMPLEMENTATION   ------------------------------------------
 //---------------------------------------------------------------------------
 /** Empty constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro() noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed();
@@ -187,8 +216,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro() noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -196,8 +225,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const unsigned int seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -205,8 +234,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned int seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -214,8 +243,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const unsigned long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -223,8 +252,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -232,8 +261,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const long long seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const unsigned long long seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_));
@@ -241,8 +270,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const unsigned long long seed_) noexce
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const utils::UInt128& seed_) noexcept
     : MyBaseClass()
 {
     MyBaseClass::seed(std::uint64_t(seed_.lo));
@@ -250,8 +279,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const utils::UInt128& seed_) noexcept
 
 //---------------------------------------------------------------------------
 /** Valued constructor. */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const double seed_)
     : MyBaseClass()
 {
     MyBaseClass::seed(seed_);
@@ -259,8 +288,8 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Valued constructor (full state). */
-template<const std::uint32_t SIZE>
-inline BaseXoroshiro<SIZE>::BaseXoroshiro(const state_type& internal_state) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline BaseXoroshiro<SIZE, EngineT>::BaseXoroshiro(const state_type& internal_state) noexcept
     : MyBaseClass()
 {
     MyBaseClass::setstate(internal_state);
@@ -268,72 +297,72 @@ inline BaseXoroshiro<SIZE>::BaseXoroshiro(const state_type& internal_state) noex
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG from current time (empty signature). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed() noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed() noexcept
 {
     MyBaseClass::seed();
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (int). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned int). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const unsigned int seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const unsigned int seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const unsigned long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const unsigned long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (long long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const long long seed_) noexcept
 {
     seed(std::uint64_t(seed_));
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned long long). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const unsigned long long seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const unsigned long long seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (unsigned 128-bits). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Initializes internal state (double). */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::seed(const double seed_)
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::seed(const double seed_)
 {
     MyBaseClass::seed(seed_);
 }
@@ -341,18 +370,63 @@ inline void BaseXoroshiro<SIZE>::seed(const double seed_)
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 64-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::_setstate(const std::uint64_t seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::_setstate(const std::uint64_t seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_);
 }
 
 //---------------------------------------------------------------------------
 /** Sets the internal state of this PRNG with a 128-bits integer seed. */
-template<const std::uint32_t SIZE>
-inline void BaseXoroshiro<SIZE>::_setstate(const utils::UInt128& seed_) noexcept
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::_setstate(const utils::UInt128& seed_) noexcept
 {
     MyBaseClass::_internal_state.state.seed(seed_.lo);
 }
 
+//---------------------------------------------------------------------------
+/** Jumps ahead in the sequence of outputs (2^(32 x SIZE) steps). */
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::jump() noexcept
+{
+    jump(EngineT::JUMP_POLYNOMIAL);
+}
+
+//---------------------------------------------------------------------------
+/** Jumps far ahead in the sequence of outputs (2^(48 x SIZE) steps). */
+template<const std::uint32_t SIZE, typename EngineT>
+inline void BaseXoroshiro<SIZE, EngineT>::long_jump() noexcept
+{
+    jump(EngineT::LONG_JUMP_POLYNOMIAL);
+}
+
+//---------------------------------------------------------------------------
+/** Jumps ahead in the sequence of outputs by the count of steps related to the specified polynomial. */
+template<const std::uint32_t SIZE, typename EngineT>
+void BaseXoroshiro<SIZE, EngineT>::jump(const std::array<value_type, SIZE>& polynomial) noexcept
+{
+    value_type* const list{ MyBaseClass::_internal_state.state.list.data() };
+    std::uint32_t index{ 0 };
+    if constexpr (EngineT::_JUMP_USES_INDEX)
+        index = MyBaseClass::_internal_state.state.index;
+
+    std::array<value_type, SIZE> s;
+    for (std::uint32_t j = 0; j < SIZE; ++j)
+        s[j] = list[(j + index) % SIZE];
+
+    std::array<value_type, SIZE> t{};
+    std::uint32_t s_index{ 0 };
+    for (value_type bits : polynomial) {
+        for (int b = 0; b < 64; ++b, bits >>= 1) {
+            if (bits & 1)
+                for (std::uint32_t j = 0; j < SIZE; ++j)
+                    t[j] ^= s[(j + s_index) % SIZE];
+            EngineT::_jump_step(s, s_index);
+        }
+    }
+
+    for (std::uint32_t j = 0; j < SIZE; ++j)
+        list[(j + index) % SIZE] = t[j];
+}
+
 /** @}*/
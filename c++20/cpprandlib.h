@@ -54,3 +54,4 @@ SOFTWARE.
 #include "xoroshiro256.h"
 #include "xoroshiro512.h"
 #include "xoroshiro1024.h"
+#include "xoroshirolanes.h"
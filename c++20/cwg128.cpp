@@ -110,6 +110,14 @@ const Cwg128::output_type Cwg128::next() noexcept
     return _internal_state.state.state ^ (_internal_state.state.a >> 96);
 }
 
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Cwg128::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Cwg128::next();
+}
+
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
 void Cwg128::seed() noexcept
@@ -33,8 +33,6 @@ SOFTWARE.
 
 
 //===========================================================================
-#include <type_traits>
-
 #include "baseclasses/basecwg.h"
 #include "utils/uint128.h"
 
@@ -103,11 +101,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Cwg128 : public BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128>
+class Cwg128 : public BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128, Cwg128>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128>;
+    using MyBaseClass = BaseCWG<utils::UInt128, utils::UInt128, utils::UInt128, 128, Cwg128>;
 
     using output_type = typename MyBaseClass::output_type;
     using state_type  = typename MyBaseClass::state_type;
@@ -132,7 +130,8 @@ public:
 
 
     //---   Internal PRNG   -------------------------------------------------
-    virtual const output_type next() noexcept override;                     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final;               //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
 
     //---   Operations   ----------------------------------------------------
@@ -150,25 +149,6 @@ public:
     virtual void _setstate(const std::uint64_t   seed_) noexcept override;  //!< Sets the internal state with a 64-bits integer seed.
     virtual void _setstate(const utils::UInt128& seed_) noexcept override;  //!< Sets the internal state with a 128-bits integer seed.
 
-
-    //---   Uniform [0, 1.0) random   ---------------------------------------
-    /** @brief The uniform distribution on [0.0, 1.0).
-    *
-    * @return a double value uniformly contained within range [0.0, 1.0).
-    */
-    template<typename T = double>
-        requires std::is_floating_point_v<T>
-    inline const T random() noexcept
-    {
-        return T(double(next()) * _NORMALIZE);
-    }
-
-    template<>
-    inline const long double random() noexcept                              //!< specialization for long double.
-    {
-        return (long double)next() * _NORMALIZE_LD;
-    }
-
 };
 
 /** @}*/
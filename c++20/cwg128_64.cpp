@@ -110,6 +110,14 @@ const Cwg128_64::output_type Cwg128_64::next() noexcept
     return (_internal_state.state.state ^ (_internal_state.state.a >> 48)).lo;
 }
 
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Cwg128_64::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Cwg128_64::next();
+}
+
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
 void Cwg128_64::seed() noexcept
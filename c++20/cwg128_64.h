@@ -103,11 +103,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Cwg128_64 : public BaseCWG<std::uint64_t, utils::UInt128, std::uint64_t, 64>
+class Cwg128_64 : public BaseCWG<std::uint64_t, utils::UInt128, std::uint64_t, 64, Cwg128_64>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseCWG<std::uint64_t, utils::UInt128, std::uint64_t, 64>;
+    using MyBaseClass = BaseCWG<std::uint64_t, utils::UInt128, std::uint64_t, 64, Cwg128_64>;
 
     using output_type = typename MyBaseClass::output_type;
     using state_type  = typename MyBaseClass::state_type;
@@ -132,7 +132,8 @@ public:
 
 
     //---   Internal PRNG   -------------------------------------------------
-    virtual const output_type next() noexcept override;     // The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; // The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
 
     //---   Operations   ----------------------------------------------------
@@ -220,6 +220,58 @@ struct NegativeRotationException : public BaseException<int>
 };
 
 
+//---------------------------------------------------------------------------
+/** @brief Negative weight value exception. */
+struct NegativeWeightException : public BaseException<double>
+{
+    inline NegativeWeightException() noexcept = default;
+    inline virtual ~NegativeWeightException() noexcept = default;
+
+    inline NegativeWeightException(const double weight)
+        : BaseException<double>(weight)
+    {}
+
+    const char* what() noexcept
+    {
+        if (_inited) {
+            _msg = "weight values (";
+            _msg += std::to_string(_value);
+            _msg += ") cannot be negative.";
+            return _msg.c_str();
+        }
+        else {
+            return "weight values cannot be negative.";
+        }
+    }
+};
+
+
+//---------------------------------------------------------------------------
+/** @brief Non finite weight value exception. */
+struct NonFiniteWeightException : public BaseException<double>
+{
+    inline NonFiniteWeightException() noexcept = default;
+    inline virtual ~NonFiniteWeightException() noexcept = default;
+
+    inline NonFiniteWeightException(const double weight)
+        : BaseException<double>(weight)
+    {}
+
+    const char* what() noexcept
+    {
+        if (_inited) {
+            _msg = "weight values (";
+            _msg += std::to_string(_value);
+            _msg += ") must be finite.";
+            return _msg.c_str();
+        }
+        else {
+            return "weight values must be finite.";
+        }
+    }
+};
+
+
 //---------------------------------------------------------------------------
 /** @brief Negative value for sigma paramater of Gauss law exception. */
 struct NormalSigmaException : public GaussSigmaException
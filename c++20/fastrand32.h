@@ -119,11 +119,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class FastRand32 : public BaseRandom<std::uint32_t, std::uint32_t, 32>
+class FastRand32 : public BaseRandom<std::uint32_t, std::uint32_t, 32, FastRand32>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<std::uint32_t, std::uint32_t, 32>;
+    using MyBaseClass = BaseRandom<std::uint32_t, std::uint32_t, 32, FastRand32>;
 
     //---   Constructors / Destructor   -------------------------------------
     inline FastRand32() noexcept;                                   //!< Empty constructor.
@@ -141,7 +141,8 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual inline const output_type next() noexcept override;      //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual inline void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
     virtual inline void seed() noexcept override;                   //!< Initializes internal state (empty signature).
 
@@ -232,6 +233,13 @@ inline const FastRand32::output_type FastRand32::next() noexcept
     return _internal_state.state = 69'069 * _internal_state.state + 1;
 }
 
+/** Fills a span with successive outputs of the internal PRNG. */
+inline void FastRand32::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = FastRand32::next();
+}
+
 /** Initializes internal state (empty signature). */
 inline void FastRand32::seed() noexcept
 {
@@ -102,7 +102,7 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class FastRand63 : public BaseRandom<std::uint64_t, std::uint64_t, 63>
+class FastRand63 : public BaseRandom<std::uint64_t, std::uint64_t, 63, FastRand63>
 {
 private:
     static const std::uint64_t _MODULO_63{ 0x7fff'ffff'ffff'ffffull };
@@ -110,7 +110,7 @@ private:
 
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseRandom<std::uint64_t, std::uint64_t, 63>;
+    using MyBaseClass = BaseRandom<std::uint64_t, std::uint64_t, 63, FastRand63>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -129,7 +129,8 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual inline const output_type next() noexcept override;      //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual inline void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
     virtual inline void seed() noexcept override;                   //!< Initializes internal state (empty signature).
 
@@ -220,6 +221,13 @@ inline const FastRand63::output_type FastRand63::next() noexcept
     return _internal_state.state = (0x7ff3'19fa'a77b'e975ull * _internal_state.state + 1) & _MODULO_63;
 }
 
+/** Fills a span with successive outputs of the internal PRNG. */
+inline void FastRand63::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = FastRand63::next();
+}
+
 /** Initializes internal state (empty signature). */
 inline void FastRand63::seed() noexcept
 {
@@ -33,14 +33,19 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
+#include <array>
 #include <type_traits>
-#include <vector>
 
 #include "../utils/splitmix.h"
 
 
 //===========================================================================
-/** @brief The internal extended state of some Pseudo Random Numbers Generators. */
+/** @brief The internal extended state of some Pseudo Random Numbers Generators.
+*
+* The extended state is stored inline, in an array aligned on a cache line,
+* so that copies do not allocate memory.
+*/
 template<typename StateType, typename ExtendedValueType, const size_t EXTENDED_SIZE>
     requires std::is_integral_v<ExtendedValueType>
 struct ExtendedState
@@ -48,8 +53,10 @@ struct ExtendedState
     using value_type = typename StateType::value_type;
     using extended_value_type = ExtendedValueType;
 
-    std::vector<extended_value_type> extended_state{};
-    StateType                        state{};
+    static constexpr std::size_t CACHE_LINE_SIZE{ 64 };
+
+    alignas(CACHE_LINE_SIZE) std::array<extended_value_type, EXTENDED_SIZE> extended_state{};
+    StateType state{};
 
     inline ExtendedState() noexcept;    //!< Empty constructor
 
@@ -64,10 +71,9 @@ struct ExtendedState
 template<typename StateType, typename ExtendedValueType, const size_t EXTENDED_SIZE>
     requires std::is_integral_v<ExtendedValueType>
 inline ExtendedState<StateType, ExtendedValueType, EXTENDED_SIZE>::ExtendedState() noexcept
-    : state{}
-{
-    extended_state.resize(EXTENDED_SIZE);
-}
+    : extended_state{}
+    , state{}
+{}
 
 //---------------------------------------------------------------------------
 template<typename StateType, typename ExtendedValueType, const size_t EXTENDED_SIZE>
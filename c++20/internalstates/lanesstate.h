@@ -0,0 +1,86 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** \addtogroup internalstates
+ *
+ *  @{
+ */
+
+
+
+//===========================================================================
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+
+//===========================================================================
+/** @brief The internal state of Pseudo Random Numbers Generators that run independent lanes.
+*
+* The states of the lanes are stored as a structure of arrays:  word j of
+* the state of every lane is stored in array lanes[j]. The same step of the
+* algorithm applied to all lanes then accesses contiguous items,  which gets
+* it evaluated with vector instructions.
+*
+* buffer contains the next outputs of the lanes for a few successive steps,
+* interleaved,  and index is the index of the next one to be returned.  When
+* index is equal to BUFFER_SIZE the buffer is empty.
+*/
+template<typename ItemT, const std::uint32_t SIZE, const std::uint32_t LANES>
+    requires std::is_unsigned_v<ItemT>
+struct LanesState
+{
+    using value_type = ItemT;
+    using lanes_type = std::array<std::array<ItemT, LANES>, SIZE>;
+
+    static constexpr std::size_t CACHE_LINE_SIZE{ 64 };
+    static constexpr std::uint32_t BUFFERED_STEPS{ (64 + LANES - 1) / LANES };
+    static constexpr std::uint32_t BUFFER_SIZE{ BUFFERED_STEPS * LANES };
+
+    alignas(CACHE_LINE_SIZE) lanes_type lanes{};
+    alignas(CACHE_LINE_SIZE) std::array<ItemT, BUFFER_SIZE> buffer{};
+    std::uint32_t index{ BUFFER_SIZE };
+
+    inline LanesState() noexcept = default;     //!< Default empty constructor.
+
+
+    /** @brief Returns true if both states are the same. */
+    inline const bool operator== (const LanesState& other) const noexcept
+    {
+        return index == other.index && lanes == other.lanes && buffer == other.buffer;
+    }
+
+
+    /** @brief Returns true if states differ. */
+    inline const bool operator!= (const LanesState& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+};
+
+/** @} */
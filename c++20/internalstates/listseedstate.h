@@ -33,39 +33,55 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <type_traits>
-#include <vector>
 
 
 //===========================================================================
-/** @brief The internal state of many Pseudo Random Numbers Generators. */
+/** @brief The internal state of many Pseudo Random Numbers Generators.
+*
+* The items of the list are stored inline, in an array aligned on a cache
+* line.  States are then copied with no memory allocation and accesses to
+* items do not dereference any pointer.  Indexes get masked rather than
+* reduced modulo SIZE when SIZE is a power of 2.
+*/
 template<typename RandomT, typename ItemT, const std::uint32_t SIZE>
     requires std::is_unsigned_v<ItemT>
 struct ListSeedState
 {
     using value_type = ItemT;
 
-    std::vector<ItemT> list{};
-    std::uint32_t      index{ 0 };
+    static constexpr std::size_t CACHE_LINE_SIZE{ 64 };
+    static constexpr bool IS_POWER_OF_2_SIZE{ (SIZE & (SIZE - 1)) == 0 };
+
+    alignas(CACHE_LINE_SIZE) std::array<ItemT, SIZE> list{};
+    std::uint32_t index{ 0 };
 
     inline ListSeedState() noexcept
-        : index(0)
-    {
-        list.resize(SIZE);
-    }
+        : list{}
+        , index(0)
+    {}
 
 
     /** @brief Increments the internal index pointing to the internal list. */
     inline void inc_index() noexcept
     {
-        index = (index + 1) % SIZE;
+        if constexpr (IS_POWER_OF_2_SIZE)
+            index = (index + 1) & (SIZE - 1);
+        else
+            index = (index + 1) % SIZE;
     }
 
 
     /** @brief Initializes the internal index pointing to the internal list. */
     inline void init_index(const std::uint32_t new_index) noexcept
     {
-        index = new_index % SIZE;
+        if constexpr (IS_POWER_OF_2_SIZE)
+            index = new_index & (SIZE - 1);
+        else
+            index = new_index % SIZE;
     }
 
 
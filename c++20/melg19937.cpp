@@ -26,6 +26,8 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
+
 #include "melg19937.h"
 
 
@@ -115,7 +117,7 @@ Melg19937::Melg19937(const state_type& internal_state) noexcept
 const Melg19937::output_type Melg19937::next() noexcept
 {
     const std::uint32_t i{ _internal_state.state.index };
-    const std::uint32_t i_1{ (i + 1) % 311 };
+    const std::uint32_t i_1{ i < 310 ? i + 1 : 0 };
 
     // sets next index in states list
     _internal_state.state.index = i_1;
@@ -127,14 +129,51 @@ const Melg19937::output_type Melg19937::next() noexcept
     };
     value_type s311{ _internal_state.state.list[311] };
 
-    s311 = (x >> 1) ^ _A_COND[x & 0x01] ^ _internal_state.state.list[(i + 81) % 311] ^ s311 ^ (s311 << 23);
+    s311 = (x >> 1) ^ _A_COND[x & 0x01] ^ _internal_state.state.list[i < 230 ? i + 81 : i - 230] ^ s311 ^ (s311 << 23);
     _internal_state.state.list[311] = s311;
 
     const value_type si{ x ^ s311 ^ (s311 >> 33) };
     _internal_state.state.list[i] = si;
 
     // finally, returns pseudo random value as a 64-bits integer
-    return si ^ (si << 16) ^ (_internal_state.state.list[std::size_t(i + 19) % 311] & 0x6aed'e6fd'97b3'38ec);
+    return si ^ (si << 16) ^ (_internal_state.state.list[i < 292 ? i + 19 : i - 292] & 0x6aed'e6fd'97b3'38ec);
+}
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Melg19937::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over segments of indexes in which
+    // none of i+1, i+81 and i+19 wraps around 311, and with s311 kept in a register
+    value_type* const list{ _internal_state.state.list.data() };
+    value_type s311{ list[311] };
+    std::uint32_t i{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_end{ i < 230 ? 230u : i < 292 ? 292u : i < 310 ? 310u : 311u };
+        const std::uint32_t d_1{ i < 310 ? 1u : 1u - 311u };      // notice: unsigned wrap-around makes i + d_1 == i + 1 - 311
+        const std::uint32_t d_m{ i < 230 ? 81u : 81u - 311u };
+        const std::uint32_t d_l{ i < 292 ? 19u : 19u - 311u };
+
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(segment_end - i, remaining)) };
+        const std::uint32_t stop{ i + count };
+        for (; i < stop; ++i) {
+            const value_type x{ (list[i] & 0xffff'fffe'0000'0000ull) | (list[i + d_1] & 0x0000'0001'ffff'ffffull) };
+            s311 = (x >> 1) ^ _A_COND[x & 0x01] ^ list[i + d_m] ^ s311 ^ (s311 << 23);
+            const value_type si{ x ^ s311 ^ (s311 >> 33) };
+            list[i] = si;
+            *out++ = si ^ (si << 16) ^ (list[i + d_l] & 0x6aed'e6fd'97b3'38ec);
+        }
+
+        remaining -= count;
+        if (i == 311)
+            i = 0;
+    }
+
+    list[311] = s311;
+    _internal_state.state.index = i;
 }
 
 //---------------------------------------------------------------------------
@@ -26,6 +26,8 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
+
 #include "melg44497.h"
 
 
@@ -115,7 +117,7 @@ Melg44497::Melg44497(const state_type& internal_state) noexcept
 const Melg44497::output_type Melg44497::next() noexcept
 {
     const std::uint32_t i{ _internal_state.state.index };
-    const std::uint32_t i_1{ (i + 1) % 695 };
+    const std::uint32_t i_1{ i < 694 ? i + 1 : 0 };
 
     // sets next index in states list
     _internal_state.state.index = i_1;
@@ -127,14 +129,51 @@ const Melg44497::output_type Melg44497::next() noexcept
     };
     value_type s695{ _internal_state.state.list[695] };
 
-    s695 = (x >> 1) ^ _A_COND[x & 0x01] ^ _internal_state.state.list[(i + 373) % 695] ^ s695 ^ (s695 << 37);
+    s695 = (x >> 1) ^ _A_COND[x & 0x01] ^ _internal_state.state.list[i < 322 ? i + 373 : i - 322] ^ s695 ^ (s695 << 37);
     _internal_state.state.list[695] = s695;
 
     const value_type si{ x ^ s695 ^ (s695 >> 14) };
     _internal_state.state.list[i] = si;
 
     // finally, returns pseudo random value as a 64-bits integer
-    return si ^ (si << 6) ^ (_internal_state.state.list[(i + 95) % 695] & 0x06fb'bee2'9aae'fd91);
+    return si ^ (si << 6) ^ (_internal_state.state.list[i < 600 ? i + 95 : i - 600] & 0x06fb'bee2'9aae'fd91);
+}
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Melg44497::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over segments of indexes in which
+    // none of i+1, i+373 and i+95 wraps around 695, and with s695 kept in a register
+    value_type* const list{ _internal_state.state.list.data() };
+    value_type s695{ list[695] };
+    std::uint32_t i{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_end{ i < 322 ? 322u : i < 600 ? 600u : i < 694 ? 694u : 695u };
+        const std::uint32_t d_1{ i < 694 ? 1u : 1u - 695u };      // notice: unsigned wrap-around makes i + d_1 == i + 1 - 695
+        const std::uint32_t d_m{ i < 322 ? 373u : 373u - 695u };
+        const std::uint32_t d_l{ i < 600 ? 95u : 95u - 695u };
+
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(segment_end - i, remaining)) };
+        const std::uint32_t stop{ i + count };
+        for (; i < stop; ++i) {
+            const value_type x{ (list[i] & 0xffff'8000'0000'0000ull) | (list[i + d_1] & 0x0000'7fff'ffff'ffffull) };
+            s695 = (x >> 1) ^ _A_COND[x & 0x01] ^ list[i + d_m] ^ s695 ^ (s695 << 37);
+            const value_type si{ x ^ s695 ^ (s695 >> 14) };
+            list[i] = si;
+            *out++ = si ^ (si << 6) ^ (list[i + d_l] & 0x06fb'bee2'9aae'fd91);
+        }
+
+        remaining -= count;
+        if (i == 695)
+            i = 0;
+    }
+
+    list[695] = s695;
+    _internal_state.state.index = i;
 }
 
 //---------------------------------------------------------------------------
@@ -26,6 +26,8 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
+
 #include "melg607.h"
 
 
@@ -115,7 +117,7 @@ Melg607::Melg607(const state_type& internal_state) noexcept
 const Melg607::output_type Melg607::next() noexcept
 {
     const std::uint32_t i{ _internal_state.state.index };
-    const std::uint32_t i_1{ (i + 1) % 9 };
+    const std::uint32_t i_1{ i < 8 ? i + 1 : 0 };
 
     // sets next index in states list
     _internal_state.state.index = i_1;
@@ -127,14 +129,51 @@ const Melg607::output_type Melg607::next() noexcept
     };
     value_type s9{ _internal_state.state.list[9] };
 
-    s9 = (x >> 1) ^ _A_COND[x & 0x01] ^ _internal_state.state.list[(i + 5) % 9] ^ s9 ^ (s9 << 13);
+    s9 = (x >> 1) ^ _A_COND[x & 0x01] ^ _internal_state.state.list[i < 4 ? i + 5 : i - 4] ^ s9 ^ (s9 << 13);
     _internal_state.state.list[9] = s9;
 
     const value_type si{ x ^ s9 ^ (s9 >> 35) };
     _internal_state.state.list[i] = si;
 
     // finally, returns pseudo random value as a 64-bits integer
-    return si ^ (si << 30) ^ (_internal_state.state.list[(i + 3) % 9] & 0x66ed'c62a'6bf8'c826ull);
+    return si ^ (si << 30) ^ (_internal_state.state.list[i < 6 ? i + 3 : i - 6] & 0x66ed'c62a'6bf8'c826ull);
+}
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Melg607::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over segments of indexes in which
+    // none of i+1, i+5 and i+3 wraps around 9, and with s9 kept in a register
+    value_type* const list{ _internal_state.state.list.data() };
+    value_type s9{ list[9] };
+    std::uint32_t i{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_end{ i < 4 ? 4u : i < 6 ? 6u : i < 8 ? 8u : 9u };
+        const std::uint32_t d_1{ i < 8 ? 1u : 1u - 9u };      // notice: unsigned wrap-around makes i + d_1 == i + 1 - 9
+        const std::uint32_t d_m{ i < 4 ? 5u : 5u - 9u };
+        const std::uint32_t d_l{ i < 6 ? 3u : 3u - 9u };
+
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(segment_end - i, remaining)) };
+        const std::uint32_t stop{ i + count };
+        for (; i < stop; ++i) {
+            const value_type x{ (list[i] & 0xffff'ffff'8000'0000ull) | (list[i + d_1] & 0x0000'0000'7fff'ffffull) };
+            s9 = (x >> 1) ^ _A_COND[x & 0x01] ^ list[i + d_m] ^ s9 ^ (s9 << 13);
+            const value_type si{ x ^ s9 ^ (s9 >> 35) };
+            list[i] = si;
+            *out++ = si ^ (si << 30) ^ (list[i + d_l] & 0x66ed'c62a'6bf8'c826ull);
+        }
+
+        remaining -= count;
+        if (i == 9)
+            i = 0;
+    }
+
+    list[9] = s9;
+    _internal_state.state.index = i;
 }
 
 //---------------------------------------------------------------------------
@@ -26,6 +26,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
 #include <cstdint>
 
 #include "mrg1457.h"
@@ -105,16 +106,57 @@ const Mrg1457::output_type Mrg1457::next() noexcept
     const std::uint32_t k24{ (index < 24) ? (index + SEED_SIZE) - 24 : index - 24 };
 
     // evaluates current value and modifies internal state
-    uint64_t value{
-        (0x0408'0000ull * (std::uint64_t(_internal_state.state.list[k1]) +
-        std::uint64_t(_internal_state.state.list[k24]) +
-        std::uint64_t(_internal_state.state.list[index]))) % _MODULO
+    const std::uint64_t value{
+        _mod_31(0x0408'0000ull * (std::uint64_t(_internal_state.state.list[k1]) +
+                                  std::uint64_t(_internal_state.state.list[k24]) +
+                                  std::uint64_t(_internal_state.state.list[index])))
     };
-    _internal_state.state.list[index] = std::uint32_t(value &= _MODULO);
+    _internal_state.state.list[index] = std::uint32_t(value);
 
     // next index
-    _internal_state.state.index = (index + 1) % SEED_SIZE;
+    _internal_state.state.index = (index < SEED_SIZE - 1) ? index + 1 : 0;
 
     // finally, returns pseudo random value as a 31-bits integer
     return output_type(value);
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Mrg1457::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over the two segments of the
+    // internal list where the i-24 -th value is at a constant distance, i.e.
+    // index + 23 in [0, 24) and index - 24 in [24, 47). The i-1 -th value is
+    // the last evaluated one, which is kept from one output to the next one.
+    std::uint32_t* const list{ _internal_state.state.list.data() };
+    std::uint32_t index{ _internal_state.state.index };
+    std::uint64_t value{ list[(index < 1) ? SEED_SIZE - 1 : index - 1] };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+
+    while (remaining > 0) {
+        const std::uint32_t segment_end{ index < 24 ? 24 : SEED_SIZE };
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(segment_end - index, remaining)) };
+        const std::uint32_t stop{ index + count };
+
+        if (index < 24) {
+            const std::uint32_t* const lagged{ list + (SEED_SIZE - 24) };
+            for (std::uint32_t i = index; i < stop; ++i) {
+                value = _mod_31(0x0408'0000ull * (value + std::uint64_t(lagged[i]) + std::uint64_t(list[i])));
+                *out++ = output_type(list[i] = std::uint32_t(value));
+            }
+        }
+        else {
+            for (std::uint32_t i = index; i < stop; ++i) {
+                value = _mod_31(0x0408'0000ull * (value + std::uint64_t(list[i - 24]) + std::uint64_t(list[i])));
+                *out++ = output_type(list[i] = std::uint32_t(value));
+            }
+        }
+
+        remaining -= count;
+        index = (stop == SEED_SIZE) ? 0 : stop;
+    }
+
+    _internal_state.state.index = index;
+}
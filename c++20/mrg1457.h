@@ -106,11 +106,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Mrg1457 : public BaseMRG31<47>
+class Mrg1457 : public BaseMRG31<47, Mrg1457>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMRG31<47>;
+    using MyBaseClass = BaseMRG31<47, Mrg1457>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -131,7 +131,8 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
 };
 
@@ -26,6 +26,8 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
+
 #include "mrg287.h"
 #include "utils/uint128.h"
 
@@ -121,3 +123,40 @@ const Mrg287::output_type Mrg287::next() noexcept
     // finally, returns pseudo random value as a 32-bits integer
     return value;
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Mrg287::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), with the internal list refreshed
+    // in place over the segments [0, 55), [55, 119), [119, 179) and  [179,
+    // 256), where the lagged values are at constant distances.  Refreshed
+    // values are then copied into the span.
+    constexpr int SIZE{ int(SEED_SIZE) };
+    value_type* const list{ _internal_state.state.list.data() };
+    std::uint32_t index{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+
+    while (remaining > 0) {
+        const std::uint32_t segment_end{ index < 55 ? 55 : index < 119 ? 119 : index < 179 ? 179 : SEED_SIZE };
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(segment_end - index, remaining)) };
+        const std::uint32_t stop{ index + count };
+
+        if (index < 55)
+            _refresh<SIZE - 55, SIZE - 119, SIZE - 179>(list, int(index), int(stop));
+        else if (index < 119)
+            _refresh<-55, SIZE - 119, SIZE - 179>(list, int(index), int(stop));
+        else if (index < 179)
+            _refresh<-55, -119, SIZE - 179>(list, int(index), int(stop));
+        else
+            _refresh<-55, -119, -179>(list, int(index), int(stop));
+
+        out = std::copy(list + index, list + stop, out);
+        remaining -= count;
+        index = stop & _INDEX_MODULO;
+    }
+
+    _internal_state.state.index = index;
+}
@@ -123,11 +123,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Mrg287 : public BaseMRG32<256>
+class Mrg287 : public BaseMRG32<256, Mrg287>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMRG32<256>;
+    using MyBaseClass = BaseMRG32<256, Mrg287>;
 
     using output_type = MyBaseClass::output_type;
     using state_type  = MyBaseClass::state_type;
@@ -152,11 +152,33 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
 
 private:
     static constexpr std::uint32_t _INDEX_MODULO{ 0xff };   // related to SEED_SIZE = 256
+    static constexpr std::uint32_t _CHUNK_SIZE{ 8 };        // notice: must not be greater than the smallest lag, i.e. 55
+
+    /** @brief Refreshes the values of the internal list with index in [i, stop).
+    *
+    * D55, D119 and D179 are the distances from any index in [i, stop) to
+    * its i-55, i-119 and i-179 -th values in the internal list.  They are
+    * the same for all indexes in [i, stop) as long as this range does  not
+    * cross any of the lags.  Values are then evaluated in chunks that are
+    * vectorized by compilers, since the values in a chunk never depend  on
+    * each other.
+    */
+    template<const int D55, const int D119, const int D179>
+    static inline void _refresh(value_type* const list, int i, const int stop) noexcept
+    {
+        for (; i + int(_CHUNK_SIZE) <= stop; i += int(_CHUNK_SIZE))
+            for (int j = i; j < i + int(_CHUNK_SIZE); ++j)
+                list[j] += list[j + D55] + list[j + D119] + list[j + D179];
+
+        for (; i < stop; ++i)
+            list[i] += list[i + D55] + list[i + D119] + list[i + D179];
+    }
 
 };
 
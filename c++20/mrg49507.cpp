@@ -26,6 +26,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
 #include <cstdint>
 
 #include "mrg49507.h"
@@ -107,22 +108,47 @@ const Mrg49507::output_type Mrg49507::next() noexcept
     const std::uint32_t k7{ (index < 7) ? (index + SEED_SIZE) - 7 : index - 7 };
 
     // evaluates current value and modifies internal state
-    const std::int64_t s = std::int64_t(_internal_state.state.list[k7]) + std::int64_t(_internal_state.state.list[index]);
-    const std::int64_t v1 = Mrg49507::_MULT * s;
-    const std::int64_t v2 = v1 % _MODULO;
-    const std::uint64_t value_ = v2 & 0x7fff'ffff;
-
-    const std::uint64_t value{
-        //(0xffff'ffff'fdff'ff80ull *  //i.e. (-2^25 - 2^7), or -67'108'992
-        (Mrg49507::_MULT *  //i.e. (-2^25 - 2^7)
-            std::int64_t(_internal_state.state.list[k7] + _internal_state.state.list[index])
-        ) % _MODULO
-    };
+    const std::uint64_t value{ _next_value(_internal_state.state.list[k7], _internal_state.state.list[index]) };
     _internal_state.state.list[index] = std::uint32_t(value);
 
     // next index
-    _internal_state.state.index = (index + 1) % SEED_SIZE;
+    _internal_state.state.index = (index < SEED_SIZE - 1) ? index + 1 : 0;
 
     // finally, returns pseudo random value as a 31-bits integer
     return output_type(value);
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Mrg49507::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over the two segments of the
+    // internal list where the i-7 -th value is at a constant distance, i.e.
+    // index + 1590 in [0, 7) and index - 7 in [7, 1597).
+    std::uint32_t* const list{ _internal_state.state.list.data() };
+    std::uint32_t index{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+
+    while (remaining > 0) {
+        const std::uint32_t segment_end{ index < 7 ? 7 : SEED_SIZE };
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(segment_end - index, remaining)) };
+        const std::uint32_t stop{ index + count };
+
+        if (index < 7) {
+            const std::uint32_t* const lagged{ list + (SEED_SIZE - 7) };
+            for (std::uint32_t i = index; i < stop; ++i)
+                *out++ = output_type(list[i] = std::uint32_t(_next_value(lagged[i], list[i])));
+        }
+        else {
+            for (std::uint32_t i = index; i < stop; ++i)
+                *out++ = output_type(list[i] = std::uint32_t(_next_value(list[i - 7], list[i])));
+        }
+
+        remaining -= count;
+        index = (stop == SEED_SIZE) ? 0 : stop;
+    }
+
+    _internal_state.state.index = index;
+}
@@ -106,11 +106,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests  that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Mrg49507 : public BaseMRG31<1597>
+class Mrg49507 : public BaseMRG31<1597, Mrg49507>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseMRG31<1597>;
+    using MyBaseClass = BaseMRG31<1597, Mrg49507>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -131,12 +131,24 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
 
 private:
     static const std::int64_t _MULT{ -(1 << 25) - (1 << 7) };
 
+    /** @brief Evaluates the next value of the recurrence from the i-7 -th and the i-1597 -th ones.
+    *
+    * Notice: the negative product gets wrapped modulo 2^64 before  it  is
+    * reduced modulo 2^31-1, as it has always been done in CppRandLib. This
+    * is kept as is to not modify the generated suites.
+    */
+    static inline const std::uint64_t _next_value(const std::uint32_t x7, const std::uint32_t x1597) noexcept
+    {
+        return _mod_31(std::uint64_t(_MULT * std::int64_t(x7 + x1597)));
+    }
+
 };
 
 /** @}*/
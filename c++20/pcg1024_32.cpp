@@ -120,6 +120,14 @@ const Pcg1024_32::output_type Pcg1024_32::next() noexcept
     return _internal_state.state.state.next() ^ extended_value;
 }
 
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Pcg1024_32::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Pcg1024_32::next();
+}
+
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
 inline void Pcg1024_32::seed() noexcept
@@ -101,11 +101,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-class Pcg1024_32 : public BasePCG<ExtendedState<Pcg64_32, std::uint32_t, 1024>, std::uint32_t>
+class Pcg1024_32 : public BasePCG<ExtendedState<Pcg64_32, std::uint32_t, 1024>, std::uint32_t, Pcg1024_32>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BasePCG<ExtendedState<Pcg64_32, std::uint32_t, 1024>, std::uint32_t>;
+    using MyBaseClass = BasePCG<ExtendedState<Pcg64_32, std::uint32_t, 1024>, std::uint32_t, Pcg1024_32>;
     using state_type = MyBaseClass::state_type;
     using value_type = MyBaseClass::state_type::value_type;
     using extended_value_type = MyBaseClass::state_type::extended_value_type;
@@ -129,7 +129,8 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
     virtual void seed() noexcept override;                  //!< Initializes internal state (empty signature).
 
@@ -120,6 +120,14 @@ const Pcg128_64::output_type Pcg128_64::next() noexcept
     return (value >> random_rotation) | ((value & ((1ull << random_rotation) - 1ull))) << (64 - random_rotation);
 }
 
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Pcg128_64::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Pcg128_64::next();
+}
+
 //---------------------------------------------------------------------------
 /** Initializes internal state (empty signature). */
 inline void Pcg128_64::seed() noexcept
@@ -201,9 +209,3 @@ void Pcg128_64::_setstate(const utils::UInt128& seed) noexcept
 {
     _internal_state.state = seed;
 }
-
-
-//===========================================================================
-/** The private constants used for the engine algorithm. */
-const utils::UInt128 Pcg128_64::_a(0x2360'ed05'1fc6'5da4ull, 0x4385'df64'9fcc'f645ull);
-const utils::UInt128 Pcg128_64::_c(0x5851'f42d'4c95'7f2dull, 0x1405'7b7e'f767'814full);
@@ -97,11 +97,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-class Pcg128_64 : public BasePCG<utils::UInt128, std::uint64_t>
+class Pcg128_64 : public BasePCG<utils::UInt128, std::uint64_t, Pcg128_64>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BasePCG<utils::UInt128, std::uint64_t>;
+    using MyBaseClass = BasePCG<utils::UInt128, std::uint64_t, Pcg128_64>;
     using value_type = utils::UInt128;
     // notice: output_type is defined in base class
 
@@ -120,7 +120,8 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
     virtual void seed() noexcept override;                  //!< Initializes internal state (empty signature).
 
@@ -138,8 +139,8 @@ public:
 
 
 private:
-    static const utils::UInt128 _a;  // (std::uint64_t(0x2360'ed05'1fc6'5da4), 0x4385'df64'9fcc'f645ull);
-    static const utils::UInt128 _c;  // (std::uint64_t(0x5851'f42d'4c95'7f2d), 0x1405'7b7e'f767'814f);
+    static constexpr utils::UInt128 _a{ 0x2360'ed05'1fc6'5da4ull, 0x4385'df64'9fcc'f645ull };
+    static constexpr utils::UInt128 _c{ 0x5851'f42d'4c95'7f2dull, 0x1405'7b7e'f767'814full };
 
 };
 
@@ -96,11 +96,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-class Pcg64_32 : public BasePCG<std::uint64_t, std::uint32_t>
+class Pcg64_32 : public BasePCG<std::uint64_t, std::uint32_t, Pcg64_32>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BasePCG<std::uint64_t, std::uint32_t>;
+    using MyBaseClass = BasePCG<std::uint64_t, std::uint32_t, Pcg64_32>;
     using value_type = std::uint64_t;
     // notice: output_type is defined in base class
 
@@ -119,7 +119,8 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;     //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual inline void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
 
     virtual inline void seed() noexcept override;           //!< Initializes internal state (empty signature).
 
@@ -137,4 +138,29 @@ public:
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm. */
+inline const Pcg64_32::output_type Pcg64_32::next() noexcept
+{
+    const value_type previous_state{ _internal_state.state };
+    const unsigned int random_shift{ previous_state >> 61 };  // random shift is set with the 3 upper bits of the internal state
+
+    // evaluates next state value
+    _internal_state.state = 0x5851'f42d'4c95'7f2dull * previous_state + 0x1405'7b7e'f767'814full;
+
+    // computes the permutated output
+    return Pcg64_32::output_type((previous_state ^ (previous_state >> 22)) >> (22 + random_shift));
+}
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+inline void Pcg64_32::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Pcg64_32::next();
+}
+
 /** @}*/
@@ -29,6 +29,7 @@ SOFTWARE.
 #include <cstdint>
 
 #include "squares32.h"
+#include "utils/target_clones.h"
 #include "utils/uint128.h"
 
 
@@ -114,27 +115,45 @@ Squares32::Squares32(const state_type& internal_state) noexcept
 }
 
 //---------------------------------------------------------------------------
-/** The internal PRNG algorithm. */
-const Squares32::output_type Squares32::next() noexcept
+/** Fills a span with successive outputs of the internal PRNG. */
+void Squares32::fill(std::span<output_type> values) noexcept
 {
-    _internal_state.state.counter++;  // notice: modulo 2^64 increment
-
-    value_type x, y, z;
-    x = y = _internal_state.state.counter * _internal_state.state.key;
-    z = y + _internal_state.state.key;
+    _fill_lanes(_internal_state.state.counter, _internal_state.state.key, values.data(), values.size());
+    _internal_state.state.counter += values.size();  // notice: modulo 2^64 increment
+}
 
-    // squaring - round 1
-    x = x * x + y;
-    x = (x >> 32) | (x << 32);
+//---------------------------------------------------------------------------
+/** Fills a span with the outputs for successive counters, with parallel workers and no modification of the internal state.
+*
+* values[i] gets at(first_counter + i). The filled values do not depend on
+* the count of workers.
+*/
+void Squares32::fill_at(std::span<output_type> values, const value_type first_counter, const std::size_t workers_count) const
+{
+    const value_type key{ _internal_state.state.key };
+    _fill_parallel(values, first_counter, workers_count,
+                   [key](const value_type counter, output_type* out, const std::size_t count) { _fill_lanes(counter, key, out, count); });
+}
 
-    // squaring - round 2
-    x = x * x + z;
-    x = (x >> 32) | (x << 32);
+//---------------------------------------------------------------------------
+/** Evaluates count successive outputs, counters starting at counter + 1.
+*
+* Outputs are pure functions of their counter, so _LANES of them are
+* evaluated at once in independent lanes that compilers vectorize.  With
+* x86-64 instructions sets, this needs AVX-512 to get 64-bits multiplies
+* in vectors, while compilers emulate them with 32-bits ones with AVX2.
+* The instructions set is selected at runtime when CPPRL_TARGET_CLONES is
+* available - see utils/target_clones.h.
+*/
+CPPRL_TARGET_CLONES
+void Squares32::_fill_lanes(value_type counter, const value_type key, output_type* out, std::size_t count) noexcept
+{
+    constexpr std::size_t _LANES{ 8 };
 
-    // squaring - round 3
-    x = x * x + y;
-    x = (x >> 32) | (x << 32);
+    for (; count >= _LANES; count -= _LANES, counter += _LANES, out += _LANES)
+        for (std::size_t j = 0; j < _LANES; ++j)
+            out[j] = _squares(counter + 1 + j, key);
 
-    // squaring - round 4
-    return output_type((x * x + z) >> 32);
+    for (std::size_t j = 0; j < count; ++j)
+        out[j] = _squares(counter + 1 + j, key);
 }
@@ -88,11 +88,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG  should
 *   definitively pass.
 */
-class Squares64 : public BaseSquares<std::uint64_t>
+class Squares64 : public BaseSquares<std::uint64_t, Squares64>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseSquares<std::uint64_t>;
+    using MyBaseClass = BaseSquares<std::uint64_t, Squares64>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -113,8 +113,68 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;      //!< The internal PRNG algorithm.
+    virtual inline const output_type next() noexcept override final; //!< The internal PRNG algorithm.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
+
+    inline const output_type at(const value_type counter) const noexcept;  //!< Returns the output for the specified counter, with no modification of the internal state.
+    void fill_at(std::span<output_type> values, const value_type first_counter, const std::size_t workers_count = 1) const;  //!< Fills a span with the outputs for successive counters, with parallel workers and no modification of the internal state.
+
+
+private:
+    static inline const output_type _squares(const value_type counter, const value_type key) noexcept;  //!< The rounds of the algorithm, as a pure function of the counter and of the key.
+    static void _fill_lanes(value_type counter, const value_type key, output_type* out, std::size_t count) noexcept;  //!< Evaluates count successive outputs, counters starting at counter + 1.
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm. */
+inline const Squares64::output_type Squares64::next() noexcept
+{
+    return _squares(++_internal_state.state.counter, _internal_state.state.key);  // notice: modulo 2^64 increment
+}
+
+//---------------------------------------------------------------------------
+/** Returns the output for the specified counter, with no modification of the internal state.
+*
+* This is the output that next() returns once it has incremented the
+* counter up to this value, i.e. at(counter + 1) is the next output of
+* this PRNG.
+*/
+inline const Squares64::output_type Squares64::at(const value_type counter) const noexcept
+{
+    return _squares(counter, _internal_state.state.key);
+}
+
+//---------------------------------------------------------------------------
+/** The rounds of the algorithm, as a pure function of the counter and of the key. */
+inline const Squares64::output_type Squares64::_squares(const value_type counter, const value_type key) noexcept
+{
+    value_type x, y, z, t;
+
+    x = y = counter * key;
+    z = y + key;
+
+    // squaring - round 1
+    x = x * x + y;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 2
+    x = x * x + z;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 3
+    x = x * x + y;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 4
+    t = x = x * x + z;
+    x = (x >> 32) | (x << 32);
+
+    // squaring - round 5
+    return t ^ ((x * x + y) >> 32);
+}
+
 /** @}*/
@@ -0,0 +1,194 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** \addtogroup utils
+ *  @{
+ */
+
+
+//===========================================================================
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "../exceptions.h"
+
+
+//===========================================================================
+namespace utils
+{
+    /** \defgroup discrete_sampler utils: Sampling of discrete distributions
+    *
+    * @{
+    */
+
+    //=======================================================================
+    /** @brief Draws indexes according to a discrete (categorical) distribution.
+    *
+    * This is an implementation of the alias method proposed by A. J. Walker
+    * in "An Efficient Method for Generating Discrete Random  Variables  with
+    * General Distributions", ACM Trans. on Mathematical Software, 3(3):253-
+    * 256, 1977,  with the numerically stable construction of the alias table
+    * described by M. D. Vose in "A Linear  Algorithm  for  Generating  Random
+    * Numbers with a Given Distribution", IEEE Trans. on Software Engineering,
+    * 17(9):972-975, 1991.
+    *
+    * The alias table is built once in O(n) time from the weights,  then each
+    * draw is evaluated in O(1) time whatever the count of weights.  Drawings
+    * select a column in the table with an unbiased bounded integer drawn by
+    * method uniform() of the passed PRNG,  then compare a separate call  to
+    * its method random() with the probability of this column.  The precision
+    * of this comparison is then the full one of random(),  whatever the count
+    * of weights.
+    *
+    * Instances of DiscreteSampler are constant once built.  They can then be
+    * shared by any number of PRNGs, and the weights that were passed at build
+    * time are never modified.
+    */
+    class DiscreteSampler
+    {
+    public:
+        //---   Constructors / Destructor   ---------------------------------
+        /** @brief Valued constructor.
+        *
+        * @param weights: the relative weights of the indexes 0 to  n-1.  They
+        *   must be finite, they must not be negative and they must not all be
+        *   zero.
+        */
+        template<typename C>
+            requires std::is_arithmetic_v<C>
+        explicit DiscreteSampler(const std::vector<C>& weights);
+
+
+        //---   Operations   ------------------------------------------------
+        /** @brief Returns an index drawn according to the weights of this sampler. */
+        template<typename PRNG>
+        inline const std::size_t draw(PRNG& prng) const noexcept
+        {
+            const std::size_t i{ prng.template uniform<std::size_t>(_table.size()) };
+
+            const _AliasEntry& entry{ _table[i] };
+            return (prng.random() < entry.proba) ? i : entry.alias;
+        }
+
+        /** @brief Fills a span with indexes drawn according to the weights of this sampler. */
+        template<typename PRNG>
+        inline void draw(PRNG& prng, std::span<std::size_t> indexes) const noexcept
+        {
+            for (std::size_t& index : indexes)
+                index = draw(prng);
+        }
+
+        /** @brief Returns the count of weights this sampler has been built with. */
+        inline const std::size_t size() const noexcept
+        {
+            return _table.size();
+        }
+
+
+    private:
+        /** @brief The entries of the alias table. */
+        struct _AliasEntry
+        {
+            double proba;
+            std::size_t alias;
+        };
+
+        std::vector<_AliasEntry> _table;
+    };
+
+
+    //=======================================================================
+    // Templates implementation
+
+    //-----------------------------------------------------------------------
+    /** Valued constructor. */
+    template<typename C>
+        requires std::is_arithmetic_v<C>
+    DiscreteSampler::DiscreteSampler(const std::vector<C>& weights)
+        : _table(weights.size())
+    {
+        const std::size_t n{ weights.size() };
+        if (n == 0)
+            throw ZeroLengthException();
+
+        double total{ 0.0 };
+        for (const C w : weights) {
+            if (!std::isfinite(double(w)))
+                throw NonFiniteWeightException(double(w));
+            if (w < C(0))
+                throw NegativeWeightException(double(w));
+            total += double(w);
+        }
+        if (total <= 0.0)
+            throw ZeroValueException();
+
+        // scales the weights so that their mean is 1.0, then dispatches them
+        std::vector<double> scaled(n);
+        std::vector<std::size_t> small, large;
+        small.reserve(n);
+        large.reserve(n);
+
+        if (!std::isfinite(total))
+            throw NonFiniteWeightException(total);
+
+        const double scale{ double(n) / total };
+        for (std::size_t i = 0; i < n; ++i) {
+            scaled[i] = double(weights[i]) * scale;
+            if (scaled[i] < 1.0)
+                small.push_back(i);
+            else
+                large.push_back(i);
+        }
+
+        // each small column gets completed with the excess of a large one
+        while (!small.empty() && !large.empty()) {
+            const std::size_t s{ small.back() };
+            const std::size_t l{ large.back() };
+            small.pop_back();
+
+            _table[s] = { scaled[s], l };
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+            if (scaled[l] < 1.0) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+
+        // remaining columns are full ones (small ones may remain only due to rounding errors)
+        for (const std::size_t l : large)
+            _table[l] = { 1.0, l };
+        for (const std::size_t s : small)
+            _table[s] = { 1.0, s };
+    }
+
+    /** @}*/
+}
+
+/** @}*/
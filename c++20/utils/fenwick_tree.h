@@ -0,0 +1,178 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** \addtogroup utils
+ *  @{
+ */
+
+
+//===========================================================================
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+
+//===========================================================================
+namespace utils
+{
+    /** \defgroup fenwick_tree utils: Binary indexed trees
+    *
+    * @{
+    */
+
+    //=======================================================================
+    /** @brief Prefix sums of non-negative values, with O(log n) updates.
+    *
+    * This is an implementation of the binary indexed trees  proposed  by  P.
+    * M. Fenwick in "A New Data Structure for Cumulative Frequency  Tables",
+    * Software: Practice and Experience, 24(3):327-336, 1994.
+    *
+    * Values are stored in O(n) memory.  Updating one of them,  evaluating a
+    * prefix sum, or searching for the index at which the prefix sums  reach
+    * some value are all done in O(log n) time.  In CppRandLib, this is used
+    * to sample elements with multiplicities without replacement,  the count
+    * of each element being decreased each time it is drawn.
+    */
+    template<typename T>
+        requires std::is_arithmetic_v<T>
+    class FenwickTree
+    {
+    public:
+        //---   Constructors / Destructor   ---------------------------------
+        /** @brief Valued constructor, builds the tree in O(n) time.
+        *
+        * @param values: the initial values.  They must not be negative  for
+        *   method find() to be meaningful.
+        */
+        template<std::ranges::random_access_range R>
+            requires std::is_arithmetic_v<std::ranges::range_value_t<R>>
+        explicit FenwickTree(const R& values);
+
+
+        //---   Operations   ------------------------------------------------
+        /** @brief Decreases the value at index by delta. */
+        inline void decrease(std::size_t index, const T delta) noexcept
+        {
+            for (++index; index < _tree.size(); index += index & (~index + 1))
+                _tree[index] -= delta;
+        }
+
+        /** @brief Returns the smallest index at which the prefix sum (this index included) gets greater than value.
+        *
+        * value must be less than total(). All  values  in  the  tree  must  be
+        * non-negative.
+        */
+        const std::size_t find(T value) const noexcept;
+
+        /** @brief Increases the value at index by delta. */
+        inline void increase(std::size_t index, const T delta) noexcept
+        {
+            for (++index; index < _tree.size(); index += index & (~index + 1))
+                _tree[index] += delta;
+        }
+
+        /** @brief Returns the sum of the count first values. */
+        const T prefix_sum(std::size_t count) const noexcept;
+
+        /** @brief Returns the count of values in this tree. */
+        inline const std::size_t size() const noexcept
+        {
+            return _tree.size() - 1;
+        }
+
+        /** @brief Returns the sum of all values. */
+        inline const T total() const noexcept
+        {
+            return prefix_sum(size());
+        }
+
+
+    private:
+        std::vector<T> _tree;   //!< 1-based tree, _tree[0] is unused
+        std::size_t _top_bit;   //!< the greatest power of 2 not greater than the count of values
+    };
+
+
+    //=======================================================================
+    // Templates implementation
+
+    //-----------------------------------------------------------------------
+    /** Valued constructor, builds the tree in O(n) time. */
+    template<typename T>
+        requires std::is_arithmetic_v<T>
+    template<std::ranges::random_access_range R>
+        requires std::is_arithmetic_v<std::ranges::range_value_t<R>>
+    FenwickTree<T>::FenwickTree(const R& values)
+        : _tree(std::ranges::size(values) + 1, T(0))
+        , _top_bit(1)
+    {
+        const std::size_t n{ std::ranges::size(values) };
+        for (std::size_t i = 1; i <= n; ++i) {
+            _tree[i] += T(values[i - 1]);
+            const std::size_t parent{ i + (i & (~i + 1)) };
+            if (parent <= n)
+                _tree[parent] += _tree[i];
+        }
+
+        while ((_top_bit << 1) <= n)
+            _top_bit <<= 1;
+    }
+
+    //-----------------------------------------------------------------------
+    /** Returns the smallest index at which the prefix sum (this index included) gets greater than value. */
+    template<typename T>
+        requires std::is_arithmetic_v<T>
+    const std::size_t FenwickTree<T>::find(T value) const noexcept
+    {
+        std::size_t index{ 0 };
+        for (std::size_t step = _top_bit; step > 0; step >>= 1) {
+            const std::size_t next{ index + step };
+            if (next < _tree.size() && _tree[next] <= value) {
+                index = next;
+                value -= _tree[next];
+            }
+        }
+        return index;  // notice: 0-based index of the next value, as it is 1-based in _tree
+    }
+
+    //-----------------------------------------------------------------------
+    /** Returns the sum of the count first values. */
+    template<typename T>
+        requires std::is_arithmetic_v<T>
+    const T FenwickTree<T>::prefix_sum(std::size_t count) const noexcept
+    {
+        T sum{ 0 };
+        for (; count > 0; count &= count - 1)
+            sum += _tree[count];
+        return sum;
+    }
+
+    /** @}*/
+}
+
+/** @}*/
@@ -0,0 +1,101 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** \addtogroup utils
+ *  @{
+ */
+
+
+//===========================================================================
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+//===========================================================================
+namespace utils
+{
+    /** \defgroup parallel_chunks utils: Parallel workers on contiguous chunks
+    *
+    * A range of n items is split into contiguous chunks, one per worker, and
+    * the workers run in parallel threads.  Chunks contain at least
+    * PARALLEL_MIN_CHUNK_SIZE items so that the cost of the threads gets
+    * negligible. This is used by the parallel shuffle of BaseRandom and by
+    * the parallel fill_at() of the Squares PRNGs.
+    *
+    * @{
+    */
+
+    //-----------------------------------------------------------------------
+    /** @brief The minimum count of items processed by each parallel worker. */
+    inline constexpr std::size_t PARALLEL_MIN_CHUNK_SIZE{ 1 << 16 };
+
+
+    //-----------------------------------------------------------------------
+    /** @brief Returns the count of workers to be run on n items, at most workers_count and never less than 1. */
+    inline constexpr std::size_t parallel_workers_count(const std::size_t n, const std::size_t workers_count) noexcept
+    {
+        return std::max(std::min(workers_count, n / PARALLEL_MIN_CHUNK_SIZE), std::size_t(1));
+    }
+
+
+    //-----------------------------------------------------------------------
+    /** @brief Returns the index of the first item of chunk w, when n items are split into w_count contiguous chunks.
+    *
+    * The sizes of the chunks differ by 1 at most,  the first chunks being the
+    * greatest ones. Chunk w ends where chunk w+1 begins,  and chunk w_count
+    * begins at n.
+    */
+    inline constexpr std::size_t chunk_begin(const std::size_t n, const std::size_t w_count, const std::size_t w) noexcept
+    {
+        return n / w_count * w + std::min(w, n % w_count);
+    }
+
+
+    //-----------------------------------------------------------------------
+    /** @brief Runs work(w) for w in [0, w_count) in parallel, and returns when all of them have completed.
+    *
+    * The calling thread runs work(0) while w_count - 1 threads run the other
+    * workers. w_count must not be 0.
+    */
+    template<typename WorkT>
+    void run_workers(const std::size_t w_count, WorkT&& work)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(w_count - 1);
+        for (std::size_t w = 1; w < w_count; ++w)
+            threads.emplace_back(work, w);
+        work(std::size_t(0));
+        for (auto& t : threads)
+            t.join();
+    }
+
+    /** @}*/
+}
+
+/** @}*/
@@ -0,0 +1,373 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** \addtogroup utils
+ *  @{
+ */
+
+
+//===========================================================================
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "../exceptions.h"
+
+
+//===========================================================================
+namespace utils
+{
+    /** \defgroup reservoir_sampler utils: Sampling of streams of unknown length
+    *
+    * @{
+    */
+
+    //=======================================================================
+    /** @brief Uniformly samples k items from a stream of unknown length.
+    *
+    * This is an implementation of Algorithm L described by K.-H. Li in "Reservoir-
+    * Sampling Algorithms of Time Complexity O(n(1 + log(N/n)))", ACM Trans.
+    * on Mathematical Software, 20(4):481-493, 1994.
+    *
+    * The k first pushed items fill the reservoir.  Then,  rather than drawing
+    * one random value per pushed item, the count of items to be skipped up to
+    * the next replacement in the reservoir is drawn from its geometric  law.
+    * The count of random draws is then O(k (1 + log(n/k))) for n pushed items.
+    * Skipped items are not even dereferenced by method push_range().
+    *
+    * At any time,  the reservoir contains a uniform sample without replacement
+    * of all the items that have been pushed, or all of them when less than k
+    * items have been pushed.  PRNG may be any PRNG of CppRandLib;  it is kept
+    * by reference, so it must outlive the sampler.
+    */
+    template<typename T, typename PRNG>
+    class ReservoirSampler
+    {
+    public:
+        //---   Constructors / Destructor   ---------------------------------
+        /** @brief Valued constructor.
+        *
+        * @param prng: the PRNG that is used for all the draws of this sampler.
+        * @param k: the size of the reservoir, must not be zero.
+        */
+        ReservoirSampler(PRNG& prng, const std::size_t k);
+
+
+        //---   Operations   ------------------------------------------------
+        /** @brief Returns the count of items that have been pushed up to now. */
+        inline const std::uint64_t count() const noexcept
+        {
+            return _count;
+        }
+
+        /** @brief Pushes one item from the stream. */
+        template<typename U>
+            requires std::is_constructible_v<T, U&&> && std::is_assignable_v<T&, U&&>
+        void push(U&& item);
+
+        /** @brief Pushes all the items of a range from the stream. */
+        template<std::ranges::input_range R>
+            requires std::is_constructible_v<T, std::ranges::range_reference_t<R>>
+        void push_range(R&& items);
+
+        /** @brief Returns the current content of the reservoir. */
+        inline const std::vector<T>& sample() const noexcept
+        {
+            return _reservoir;
+        }
+
+
+    private:
+        std::vector<T> _reservoir;
+        PRNG& _prng;
+        std::size_t _k;
+        std::uint64_t _count{ 0 };          //!< the count of items pushed up to now
+        std::uint64_t _next_index{ 0 };     //!< the index of the next pushed item that will enter the reservoir
+        double _log_w{ 0.0 };               //!< the logarithm of W in Algorithm L
+
+        /** @brief Evaluates the index of the next item that will enter the reservoir. */
+        void _evaluate_next_index() noexcept;
+
+        /** @brief Returns a uniform value in (0.0, 1.0]. */
+        inline const double _random_open0() noexcept
+        {
+            return 1.0 - _prng.random();
+        }
+    };
+
+
+    //=======================================================================
+    /** @brief Samples k items from a stream of weighted items of unknown length.
+    *
+    * This is an implementation of algorithm A-ExpJ described by P. S.
+    * Efraimidis and P. G. Spirakis in "Weighted random sampling with a
+    * reservoir", Information Processing Letters, 97(5):181-185, 2006.
+    *
+    * Each item in the reservoir gets the key u^(1/w), with u uniform in (0, 1)
+    * and w the weight of the item, and the reservoir keeps the k items with
+    * the greatest keys. Rather than evaluating a key for each pushed item,
+    * the cumulated weight of the items to be skipped up to the next  entry
+    * in the reservoir is drawn from its exponential law.  Keys are stored as
+    * their logarithm for numerical accuracy with very small weights.
+    *
+    * Items with a zero weight are never selected.  PRNG may be any PRNG of
+    * CppRandLib; it is kept by reference, so it must outlive the sampler.
+    */
+    template<typename T, typename PRNG>
+    class WeightedReservoirSampler
+    {
+    public:
+        //---   Constructors / Destructor   ---------------------------------
+        /** @brief Valued constructor.
+        *
+        * @param prng: the PRNG that is used for all the draws of this sampler.
+        * @param k: the size of the reservoir, must not be zero.
+        */
+        WeightedReservoirSampler(PRNG& prng, const std::size_t k);
+
+
+        //---   Operations   ------------------------------------------------
+        /** @brief Returns the count of items that have been pushed up to now. */
+        inline const std::uint64_t count() const noexcept
+        {
+            return _count;
+        }
+
+        /** @brief Pushes one weighted item from the stream. weight must not be negative. */
+        template<typename U>
+            requires std::is_constructible_v<T, U&&>
+        void push(U&& item, const double weight);
+
+        /** @brief Pushes all the items of a range from the stream, with their weights. */
+        template<std::ranges::input_range R, std::ranges::input_range W>
+            requires std::is_constructible_v<T, std::ranges::range_reference_t<R>> &&
+                     std::is_convertible_v<std::ranges::range_reference_t<W>, double>
+        void push_range(R&& items, W&& weights);
+
+        /** @brief Returns the current content of the reservoir, in no specific order. */
+        const std::vector<T> sample() const;
+
+
+    private:
+        /** @brief The entries of the reservoir, as a min-heap on their keys. */
+        struct _Entry
+        {
+            double log_key;
+            T item;
+        };
+
+        static inline bool _greater(const _Entry& a, const _Entry& b) noexcept
+        {
+            return a.log_key > b.log_key;
+        }
+
+        std::vector<_Entry> _reservoir;
+        PRNG& _prng;
+        std::size_t _k;
+        std::uint64_t _count{ 0 };          //!< the count of items pushed up to now
+        double _skipped_weight{ 0.0 };      //!< the weight that remains to be skipped up to the next entry in the reservoir
+
+        /** @brief Evaluates the weight to be skipped up to the next entry in the reservoir. */
+        void _evaluate_skipped_weight() noexcept;
+
+        /** @brief Returns a uniform value in (0.0, 1.0]. */
+        inline const double _random_open0() noexcept
+        {
+            return 1.0 - _prng.random();
+        }
+    };
+
+
+    //=======================================================================
+    // Templates implementation
+
+    //-----------------------------------------------------------------------
+    /** Valued constructor. */
+    template<typename T, typename PRNG>
+    ReservoirSampler<T, PRNG>::ReservoirSampler(PRNG& prng, const std::size_t k)
+        : _prng(prng)
+        , _k(k)
+    {
+        if (k == 0)
+            throw ZeroLengthException();
+        _reservoir.reserve(k);
+    }
+
+    //-----------------------------------------------------------------------
+    /** Pushes one item from the stream. */
+    template<typename T, typename PRNG>
+    template<typename U>
+        requires std::is_constructible_v<T, U&&> && std::is_assignable_v<T&, U&&>
+    void ReservoirSampler<T, PRNG>::push(U&& item)
+    {
+        if (_count < _k) {
+            _reservoir.emplace_back(std::forward<U>(item));
+            if (++_count == _k) {
+                _log_w = std::log(_random_open0()) / double(_k);
+                _evaluate_next_index();
+            }
+        }
+        else if (_count++ == _next_index) {
+            _reservoir[_prng.template uniform<std::size_t>(_k)] = std::forward<U>(item);
+            _log_w += std::log(_random_open0()) / double(_k);
+            _evaluate_next_index();
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    /** Pushes all the items of a range from the stream. */
+    template<typename T, typename PRNG>
+    template<std::ranges::input_range R>
+        requires std::is_constructible_v<T, std::ranges::range_reference_t<R>>
+    void ReservoirSampler<T, PRNG>::push_range(R&& items)
+    {
+        auto it{ std::ranges::begin(items) };
+        const auto end{ std::ranges::end(items) };
+
+        // fills the reservoir
+        for (; _count < _k && it != end; ++it)
+            push(*it);
+
+        // then jumps from one replacement to the next one
+        while (it != end) {
+            const std::uint64_t skip{ _next_index - _count };
+            using DiffT = std::iter_difference_t<decltype(it)>;
+            const DiffT max_skip{ std::numeric_limits<DiffT>::max() };
+            const DiffT not_skipped{ std::ranges::advance(it, skip > std::uint64_t(max_skip) ? max_skip : DiffT(skip), end) };
+            _count += skip - std::uint64_t(not_skipped);
+            if (it == end)
+                break;
+
+            push(*it);  // notice: _count == _next_index here
+            ++it;
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    /** Evaluates the index of the next item that will enter the reservoir. */
+    template<typename T, typename PRNG>
+    void ReservoirSampler<T, PRNG>::_evaluate_next_index() noexcept
+    {
+        // notice: log(1 - W) with W = exp(_log_w)
+        const double skip{ std::floor(std::log(_random_open0()) / std::log1p(-std::exp(_log_w))) };
+        constexpr double MAX_SKIP{ 9.0e18 };  // notice: less than 2^63, no stream will ever get that long
+        _next_index = _count + (skip < MAX_SKIP ? std::uint64_t(skip) : std::uint64_t(MAX_SKIP));
+    }
+
+
+    //-----------------------------------------------------------------------
+    /** Valued constructor. */
+    template<typename T, typename PRNG>
+    WeightedReservoirSampler<T, PRNG>::WeightedReservoirSampler(PRNG& prng, const std::size_t k)
+        : _prng(prng)
+        , _k(k)
+    {
+        if (k == 0)
+            throw ZeroLengthException();
+        _reservoir.reserve(k);
+    }
+
+    //-----------------------------------------------------------------------
+    /** Pushes one weighted item from the stream. */
+    template<typename T, typename PRNG>
+    template<typename U>
+        requires std::is_constructible_v<T, U&&>
+    void WeightedReservoirSampler<T, PRNG>::push(U&& item, const double weight)
+    {
+        if (weight < 0.0)
+            throw NegativeWeightException(weight);
+
+        ++_count;
+        if (weight == 0.0)
+            return;
+
+        if (_reservoir.size() < _k) {
+            _reservoir.push_back({ std::log(_random_open0()) / weight, T(std::forward<U>(item)) });
+            std::ranges::push_heap(_reservoir, _greater);
+            if (_reservoir.size() == _k)
+                _evaluate_skipped_weight();
+        }
+        else {
+            _skipped_weight -= weight;
+            if (_skipped_weight <= 0.0) {
+                // the new key is drawn in (T_w, 1), T_w being the smallest key in the reservoir
+                const double t_w{ std::exp(_reservoir.front().log_key * weight) };
+                const double r2{ t_w + (1.0 - t_w) * _random_open0() };
+
+                std::ranges::pop_heap(_reservoir, _greater);
+                _reservoir.back() = { std::log(r2) / weight, T(std::forward<U>(item)) };
+                std::ranges::push_heap(_reservoir, _greater);
+
+                _evaluate_skipped_weight();
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------
+    /** Pushes all the items of a range from the stream, with their weights. */
+    template<typename T, typename PRNG>
+    template<std::ranges::input_range R, std::ranges::input_range W>
+        requires std::is_constructible_v<T, std::ranges::range_reference_t<R>> &&
+                 std::is_convertible_v<std::ranges::range_reference_t<W>, double>
+    void WeightedReservoirSampler<T, PRNG>::push_range(R&& items, W&& weights)
+    {
+        auto w_it{ std::ranges::begin(weights) };
+        const auto w_end{ std::ranges::end(weights) };
+        for (auto it = std::ranges::begin(items); it != std::ranges::end(items) && w_it != w_end; ++it, ++w_it)
+            push(*it, double(*w_it));
+    }
+
+    //-----------------------------------------------------------------------
+    /** Returns the current content of the reservoir, in no specific order. */
+    template<typename T, typename PRNG>
+    const std::vector<T> WeightedReservoirSampler<T, PRNG>::sample() const
+    {
+        std::vector<T> items;
+        items.reserve(_reservoir.size());
+        for (const _Entry& entry : _reservoir)
+            items.push_back(entry.item);
+        return items;
+    }
+
+    //-----------------------------------------------------------------------
+    /** Evaluates the weight to be skipped up to the next entry in the reservoir. */
+    template<typename T, typename PRNG>
+    void WeightedReservoirSampler<T, PRNG>::_evaluate_skipped_weight() noexcept
+    {
+        // notice: X_w = log(r) / log(T_w), with log(T_w) being the smallest log-key in the reservoir
+        _skipped_weight = std::log(_random_open0()) / _reservoir.front().log_key;
+    }
+
+    /** @}*/
+}
+
+/** @}*/
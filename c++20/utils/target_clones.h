@@ -0,0 +1,61 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** \addtogroup utils
+ *  @{
+ */
+
+
+//===========================================================================
+#include <cstdint>  // notice: also gets the C library configuration macros, e.g. __GLIBC__
+
+
+//===========================================================================
+/** \defgroup target_clones utils: Runtime selection of instructions sets
+*
+* Bulk generation kernels of CppRandLib are written as portable loops over
+* a few independent lanes,  which compilers vectorize according to their
+* target instructions set.
+*
+* Functions declared with CPPRL_TARGET_CLONES get compiled once per listed
+* instructions set: x86-64-v4 (AVX-512), x86-64-v3 (AVX2) and the default
+* one.  The best one for the running CPU is selected once,  when the code
+* gets loaded.  This is available with gcc on x86-64 GNU/Linux platforms.
+* Everywhere else CPPRL_TARGET_CLONES is empty, and the portable loops get
+* compiled with the options of the compiler, vectorized or not.
+*
+* @{
+*/
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11) && defined(__x86_64__) && defined(__GLIBC__)
+    #define CPPRL_TARGET_CLONES __attribute__((target_clones("arch=x86-64-v4", "arch=x86-64-v3", "default")))
+#else
+    #define CPPRL_TARGET_CLONES
+#endif
+
+/** @}*/
+
+/** @}*/
@@ -34,6 +34,10 @@ SOFTWARE.
 #include <cstdint>
 #include <type_traits>
 
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
 
 namespace utils
 {
@@ -53,13 +57,22 @@ namespace utils
     *   implemented  PRNGs in CppRandLib use this type of arithmetic.  So,
     *   this class implements a minimalist version of 128-bits arithmetic:
     *   addition, multiplication and bit -shift, -or and -xor operators.
+    *
+    *   When the compiler provides type unsigned __int128 (e.g. gcc and clang
+    *   on 64-bits platforms), additions and multiplications are evaluated
+    *   with it. Otherwise, the 64 x 64 bits products are evaluated with the
+    *   compiler intrinsics when available (e.g. _umul128 with Visual Studio
+    *   on x64 platforms, __umulh on ARM64 ones),  or with 32-bits words as
+    *   a fallback and in constant evaluations. All the operations are thus
+    *   constexpr and inlined, and the type is a trivially copyable pair  of
+    *   64-bits words.
     */
     class UInt128
     {
     public:
 
         //---   Constructors / Destructor   -------------------------------------
-        inline UInt128(const std::uint64_t hi_, const std::uint64_t lo_)    //!< Valued constructor (UInt128)
+        inline constexpr UInt128(const std::uint64_t hi_, const std::uint64_t lo_) noexcept   //!< Valued constructor (UInt128)
             : hi(hi_)
             , lo(lo_)
         {
@@ -67,130 +80,203 @@ namespace utils
 
         template<typename IntT>
             requires std::is_integral_v<IntT>
-        inline UInt128(const IntT val)  //!< Valued constructor (integer)
+        inline constexpr UInt128(const IntT val) noexcept   //!< Valued constructor (integer)
             : hi(0ull)
             , lo(std::uint64_t(val))
         {}
 
-        inline UInt128() noexcept = default;                    //!< Default empty constructor
-        inline UInt128(const UInt128&) noexcept = default;      //!< Default copy constructor
-        inline UInt128(UInt128&&) noexcept = default;           //!< Default move constructor
-        inline virtual ~UInt128() noexcept = default;           //!< Default destructor
+        inline constexpr UInt128() noexcept = default;                  //!< Default empty constructor
+        inline constexpr UInt128(const UInt128&) noexcept = default;    //!< Default copy constructor
+        inline constexpr UInt128(UInt128&&) noexcept = default;         //!< Default move constructor
+        inline ~UInt128() noexcept = default;                           //!< Default destructor
 
 
         //---   Assignment   ----------------------------------------------------
-        inline UInt128& operator=(const UInt128&) noexcept = default;   //!< Default copy assignment
-        inline UInt128& operator=(UInt128&&) noexcept = default;        //!< Default move assignment
+        inline constexpr UInt128& operator=(const UInt128&) noexcept = default;   //!< Default copy assignment
+        inline constexpr UInt128& operator=(UInt128&&) noexcept = default;        //!< Default move assignment
 
         template<typename IntT>
             requires std::is_integral_v<IntT>
-        inline UInt128& operator= (const IntT val) noexcept
+        inline constexpr UInt128& operator= (const IntT val) noexcept
         {
             hi = 0;
-            lo = val;
+            lo = std::uint64_t(val);
             return *this;
         }
 
 
         //---   Cast operators   ------------------------------------------------
-        inline explicit operator const double() const noexcept           //!< 64-bits float const casting operator
+        inline constexpr explicit operator const double() const noexcept           //!< 64-bits float const casting operator
         {
             return hi * 18.446'744'073'709'551'616e+18 + double(lo);
         }
 
-        inline explicit operator const long double() const noexcept     //!< 128-bits float const casting operator
+        inline constexpr explicit operator const long double() const noexcept     //!< 128-bits float const casting operator
         {
             return hi * 18.446'744'073'709'551'616e+18l + (long double)lo;
         }
 
 
         //---   Add   -----------------------------------------------------------
-        UInt128& operator+= (const UInt128& other) noexcept;
-        UInt128& operator+= (const std::uint64_t other) noexcept;
+        inline constexpr UInt128& operator+= (const UInt128& other) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            return _set(_native() + other._native());
+#else
+            const std::uint64_t sum_lo{ lo + other.lo };
+            hi += other.hi + (sum_lo < lo);  // notice: carry from the low word
+            lo = sum_lo;
+            return *this;
+#endif
+        }
+
+        inline constexpr UInt128& operator+= (const std::uint64_t value) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            return _set(_native() + value);
+#else
+            const std::uint64_t sum_lo{ lo + value };
+            hi += (sum_lo < lo);  // notice: carry from the low word
+            lo = sum_lo;
+            return *this;
+#endif
+        }
 
-        inline const UInt128 operator+ (const UInt128& other) const noexcept
+        inline constexpr const UInt128 operator+ (const UInt128& other) const noexcept
         {
             UInt128 t{ *this };
             return t += other;
         }
 
-        inline const UInt128 operator+ (const std::uint64_t other) const noexcept
+        inline constexpr const UInt128 operator+ (const std::uint64_t other) const noexcept
         {
             UInt128 t{ *this };
             return t += other;
         }
 
-        inline friend const UInt128 operator+ (const std::uint64_t lhs, const UInt128& rhs)
+        inline constexpr friend const UInt128 operator+ (const std::uint64_t lhs, const UInt128& rhs) noexcept
         {
             return rhs + lhs;  // notice: addition is commutative
         }
 
 
         //---   Bit-or   --------------------------------------------------------
-        inline UInt128& operator|= (const UInt128& other) noexcept
+        inline constexpr UInt128& operator|= (const UInt128& other) noexcept
         {
             hi |= other.hi;
             lo |= other.lo;
             return *this;
         }
 
-        inline UInt128& operator|= (const std::uint64_t value) noexcept
+        inline constexpr UInt128& operator|= (const std::uint64_t value) noexcept
         {
             lo |= value;
             return *this;
         }
 
-        inline const UInt128 operator| (const UInt128& other) const noexcept
+        inline constexpr const UInt128 operator| (const UInt128& other) const noexcept
         {
             UInt128 t{ *this };
             return t |= other;
         }
 
-        inline const UInt128 operator| (const std::uint64_t value) const noexcept
+        inline constexpr const UInt128 operator| (const std::uint64_t value) const noexcept
         {
             UInt128 t{ *this };
             return t |= value;
         }
 
-        inline friend const UInt128 operator| (const std::uint64_t lhs, const UInt128& rhs)
+        inline constexpr friend const UInt128 operator| (const std::uint64_t lhs, const UInt128& rhs) noexcept
         {
             return rhs | lhs;  // notice: xor operator is commutative
         }
 
 
         //---   Mul   -----------------------------------------------------------
-        UInt128& operator*= (const UInt128& other) noexcept;
-        UInt128& operator*= (const std::uint64_t other) noexcept;
+        inline constexpr UInt128& operator*= (const UInt128& other) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            return _set(_native() * other._native());
+#else
+            const UInt128 lo_product{ _mul_64_64(lo, other.lo) };
+            hi = lo_product.hi + (hi * other.lo) + (lo * other.hi);
+            lo = lo_product.lo;
+            return *this;
+#endif
+        }
+
+        inline constexpr UInt128& operator*= (const std::uint64_t value) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            return _set(_native() * value);
+#else
+            const UInt128 lo_product{ _mul_64_64(lo, value) };
+            hi = lo_product.hi + (hi * value);
+            lo = lo_product.lo;
+            return *this;
+#endif
+        }
 
-        inline const UInt128 operator* (const UInt128& other) const noexcept
+        inline constexpr const UInt128 operator* (const UInt128& other) const noexcept
         {
             UInt128 t{ *this };
             return t *= other;
         }
 
-        inline const UInt128 operator* (const std::uint64_t value) const noexcept
+        inline constexpr const UInt128 operator* (const std::uint64_t value) const noexcept
         {
             UInt128 t{ *this };
             return t *= value;
         }
 
-        inline friend const UInt128 operator* (const std::uint64_t lhs, const UInt128& rhs)
+        inline constexpr friend const UInt128 operator* (const std::uint64_t lhs, const UInt128& rhs) noexcept
         {
             return rhs * lhs;  // notice: multiplication is commutative
         }
 
 
         //---   Shifts   --------------------------------------------------------
-        UInt128& operator>>= (const unsigned int shift) noexcept;
-        UInt128& operator<<= (const unsigned int shift) noexcept;
+        inline constexpr UInt128& operator>>= (const unsigned int shift) noexcept
+        {
+            if (shift >= 128) {
+                hi = lo = 0ull;
+            }
+            else if (shift >= 64) {
+                lo = hi >> (shift - 64);
+                hi = 0ull;
+            }
+            else if (shift > 0) {
+                lo = (lo >> shift) | (hi << (64 - shift));
+                hi >>= shift;
+            }
+
+            return *this;
+        }
 
-        UInt128 operator>> (const unsigned int shift) noexcept
+        inline constexpr UInt128& operator<<= (const unsigned int shift) noexcept
+        {
+            if (shift >= 128) {
+                hi = lo = 0ull;
+            }
+            else if (shift >= 64) {
+                hi = lo << (shift - 64);
+                lo = 0ull;
+            }
+            else if (shift > 0) {
+                hi = (hi << shift) | (lo >> (64 - shift));
+                lo <<= shift;
+            }
+
+            return *this;
+        }
+
+        inline constexpr UInt128 operator>> (const unsigned int shift) const noexcept
         {
             UInt128 t{ *this };
             return t >>= shift;
         }
 
-        UInt128 operator<< (const unsigned int shift) noexcept
+        inline constexpr UInt128 operator<< (const unsigned int shift) const noexcept
         {
             UInt128 t{ *this };
             return t <<= shift;
@@ -198,32 +284,32 @@ namespace utils
 
 
         //---   Xor   -----------------------------------------------------------
-        inline UInt128& operator^= (const UInt128& other) noexcept
+        inline constexpr UInt128& operator^= (const UInt128& other) noexcept
         {
             hi ^= other.hi;
             lo ^= other.lo;
             return *this;
         }
 
-        inline UInt128& operator^= (const std::uint64_t value) noexcept
+        inline constexpr UInt128& operator^= (const std::uint64_t value) noexcept
         {
             lo ^= value;
             return *this;
         }
 
-        inline const UInt128 operator^ (const UInt128& other) const noexcept
+        inline constexpr const UInt128 operator^ (const UInt128& other) const noexcept
         {
             UInt128 t{ *this };
             return t ^= other;
         }
 
-        inline const UInt128 operator^ (const std::uint64_t value) const noexcept
+        inline constexpr const UInt128 operator^ (const std::uint64_t value) const noexcept
         {
             UInt128 t{ *this };
             return t ^= value;
         }
 
-        inline friend const UInt128 operator^ (const std::uint64_t lhs, const UInt128& rhs)
+        inline constexpr friend const UInt128 operator^ (const std::uint64_t lhs, const UInt128& rhs) noexcept
         {
             return rhs ^ lhs;  // notice: xor operator is commutative
         }
@@ -231,42 +317,42 @@ namespace utils
 
         //---   Comparisons   ---------------------------------------------------
         // notice: mainly for test purposes
-        inline const bool operator== (const UInt128& other) const noexcept
+        inline constexpr const bool operator== (const UInt128& other) const noexcept
         {
             return hi == other.hi && lo == other.lo;
         }
 
         template<typename IntT>
             requires std::is_integral_v<IntT>
-        inline const bool operator== (const IntT value) const noexcept
+        inline constexpr const bool operator== (const IntT value) const noexcept
         {
             return hi == 0 && lo == std::uint64_t(value);
         }
 
         template<typename IntT>
             requires std::is_integral_v<IntT>
-        inline friend const bool operator== (const IntT lhs, const UInt128& rhs) noexcept
+        inline constexpr friend const bool operator== (const IntT lhs, const UInt128& rhs) noexcept
         {
-            return rhs == lhs;
+            return rhs.hi == 0 && rhs.lo == std::uint64_t(lhs);  // notice: c++20 rewritten comparisons would make 'rhs == lhs' recurse
         }
 
-        inline const bool operator!= (const UInt128& other) const noexcept
+        inline constexpr const bool operator!= (const UInt128& other) const noexcept
         {
             return hi != other.hi || lo != other.lo;
         }
 
         template<typename IntT>
             requires std::is_integral_v<IntT>
-        inline const bool operator!= (const IntT value) const noexcept
+        inline constexpr const bool operator!= (const IntT value) const noexcept
         {
             return hi != 0 || lo != std::uint64_t(value);
         }
 
         template<typename IntT>
             requires std::is_integral_v<IntT>
-        inline friend const bool operator!= (const IntT lhs, const UInt128& rhs) noexcept
+        inline constexpr friend const bool operator!= (const IntT lhs, const UInt128& rhs) noexcept
         {
-            return rhs != lhs;
+            return rhs.hi != 0 || rhs.lo != std::uint64_t(lhs);
         }
 
 
@@ -277,13 +363,49 @@ namespace utils
 
     private:
         //---   internal operations   -------------------------------------------
-        static inline const bool _add_carry(std::uint32_t& w, const std::uint32_t a, const bool carry = false)
+#if defined(__SIZEOF_INT128__)
+        /** @brief Returns the native 128-bits value of this instance. */
+        inline constexpr unsigned __int128 _native() const noexcept
+        {
+            return ((unsigned __int128)hi << 64) | lo;
+        }
+
+        /** @brief Sets this instance from a native 128-bits value. */
+        inline constexpr UInt128& _set(const unsigned __int128 value) noexcept
+        {
+            hi = std::uint64_t(value >> 64);
+            lo = std::uint64_t(value);
+            return *this;
+        }
+#else
+        /** @brief Returns the full 128-bits product of two 64-bits words. */
+        static inline constexpr UInt128 _mul_64_64(const std::uint64_t a, const std::uint64_t b) noexcept
         {
-            std::uint64_t t{ w };
-            t += std::uint64_t(a) + carry;
-            w = t & 0xffff'ffffull;
-            return t & 0x1'0000'0000ull;
+#if defined(_MSC_VER) && defined(_M_X64)
+            if (!std::is_constant_evaluated()) {
+                std::uint64_t prod_hi;
+                const std::uint64_t prod_lo{ _umul128(a, b, &prod_hi) };
+                return UInt128(prod_hi, prod_lo);
+            }
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+            if (!std::is_constant_evaluated())
+                return UInt128(__umulh(a, b), a * b);
+#endif
+
+            // notice: portable schoolbook product, also used in constant evaluations
+            const std::uint64_t
+                a0{ a & 0xffff'ffff },
+                a1{ a >> 32 },
+                b0{ b & 0xffff'ffff },
+                b1{ b >> 32 },
+                a0b0{ a0 * b0 },
+                a1b0{ a1 * b0 + (a0b0 >> 32) },
+                a0b1{ a0 * b1 + (a1b0 & 0xffff'ffff) },
+                a1b1{ a1 * b1 };
+
+            return UInt128(a1b1 + (a1b0 >> 32) + (a0b1 >> 32), (a0b1 << 32) + (a0b0 & 0xffff'ffff));
         }
+#endif
 
     };
 
@@ -38,10 +38,16 @@ SOFTWARE.
 //===========================================================================
 #include "balanced_bits_generation.h"
 #include "bits_rotations.h"
+#include "discrete_sampler.h"
+#include "fenwick_tree.h"
+#include "parallel_chunks.h"
+#include "reservoir_sampler.h"
 #include "seed_generation.h"
 #include "splitmix.h"
+#include "target_clones.h"
 #include "time.h"
 #include "type_traits.h"
 #include "uint128.h"
+#include "ziggurat.h"
 
 /** @}*/
@@ -0,0 +1,477 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/** \addtogroup utils
+ *  @{
+ */
+
+
+//===========================================================================
+#include <array>
+#include <cstdint>
+
+
+//===========================================================================
+namespace utils
+{
+    /** \defgroup ziggurat utils: Ziggurat tables for normal and exponential distributions
+    *
+    * Precomputed tables for the ziggurat method of G. Marsaglia and W. W. Tsang
+    * ("The Ziggurat Method for Generating Random Variables",  Journal  of
+    * Statistical Software, 5(8), 2000),  with 256 layers of equal areas and
+    * the 64-bits random integers layout used in BaseRandom. Layer 0 is the
+    * base layer, which embeds the tail of the distribution.
+    *
+    * For each layer i:
+    * - *_K[i] is the ratio x[i-1] / x[i], scaled to the random integers width;
+    * - *_W[i] is x[i], scaled down by the random integers width;
+    * - *_F[i] is the density f(x[i]) - f() being not normalized, i.e. f(0) = 1.
+    *
+    * Tables have been evaluated with 60 significant digits arithmetic.
+    *
+    * @{
+    */
+
+    namespace ziggurat
+    {
+        //---   Normal distribution   ---------------------------------------
+        // notice: random integers are 52-bits wide
+        inline constexpr double NORMAL_R{ 3.654152885361009 };  // i.e. the right-most abscissa of base layer
+        inline constexpr double NORMAL_INV_R{ 0.2736612373297583 };
+
+        inline constexpr std::array<std::uint64_t, 256> NORMAL_K{
+            0x000ef33d8025ef65ull, 0x0000000000000000ull, 0x000c08be98fbc6b6ull, 0x000da354fabd8146ull,
+            0x000e51f67ec1eeecull, 0x000eb255e9d3f77eull, 0x000eef4b817ecab8ull, 0x000f19470afa44abull,
+            0x000f37ed61ffcb17ull, 0x000f4f469561255bull, 0x000f61a5e41ba396ull, 0x000f707a755396a4ull,
+            0x000f7cb2ec28449bull, 0x000f86f10c6357d2ull, 0x000f8fa6578325ddull, 0x000f9724c74dd0daull,
+            0x000f9da907dbf508ull, 0x000fa360f581fa72ull, 0x000fa86fde5b4bf8ull, 0x000facf160d354dbull,
+            0x000fb0fb6718b90eull, 0x000fb49f8d5374c5ull, 0x000fb7ec2366fe77ull, 0x000fbaece9a1e50cull,
+            0x000fbdab9d040bedull, 0x000fc03060ff6c57ull, 0x000fc2821037a248ull, 0x000fc4a67ae25bd1ull,
+            0x000fc6a2977aee30ull, 0x000fc87aa92896a4ull, 0x000fca325e4bde85ull, 0x000fcbcce902231aull,
+            0x000fcd4d12f839c4ull, 0x000fceb54d8fec99ull, 0x000fd007bf1dc930ull, 0x000fd1464dd6c4e5ull,
+            0x000fd272a8e2f450ull, 0x000fd38e4ff0c91eull, 0x000fd49a9990b479ull, 0x000fd598b8920f52ull,
+            0x000fd689c08e99ecull, 0x000fd76ea9c8e832ull, 0x000fd848547b08e8ull, 0x000fd9178bad2c8bull,
+            0x000fd9dd07a7add2ull, 0x000fda9970105e8bull, 0x000fdb4d5dc02e1full, 0x000fdbf95c5bfcd0ull,
+            0x000fdc9debb99a7dull, 0x000fdd3b8118729dull, 0x000fddd288342f8full, 0x000fde6364369f63ull,
+            0x000fdeee708d514eull, 0x000fdf7401a6b42eull, 0x000fdff46599ed3eull, 0x000fe06fe4bc24f1ull,
+            0x000fe0e6c225a258ull, 0x000fe1593c28b84bull, 0x000fe1c78cbc3f98ull, 0x000fe231e9db1ca9ull,
+            0x000fe29885da1b91ull, 0x000fe2fb8fb54186ull, 0x000fe35b33558d4aull, 0x000fe3b799d0002aull,
+            0x000fe410e99ead7eull, 0x000fe46746d47734ull, 0x000fe4bad34c095bull, 0x000fe50baed29524ull,
+            0x000fe559f74ebc77ull, 0x000fe5a5c8e41212ull, 0x000fe5ef3e138689ull, 0x000fe6366fd91077ull,
+            0x000fe67b75c6d578ull, 0x000fe6be661e11aaull, 0x000fe6ff55e5f4f2ull, 0x000fe73e5900a701ull,
+            0x000fe77b823e9e39ull, 0x000fe7b6e37070a1ull, 0x000fe7f08d774242ull, 0x000fe8289053f08cull,
+            0x000fe85efb35173bull, 0x000fe893dc840864ull, 0x000fe8c741f0cebcull, 0x000fe8f9387d4ef6ull,
+            0x000fe929cc879b1cull, 0x000fe95909d388eaull, 0x000fe986fb939aa1ull, 0x000fe9b3ac714865ull,
+            0x000fe9df2694b6d5ull, 0x000fea0973abe67bull, 0x000fea329cf166a4ull, 0x000fea5aab32952cull,
+            0x000fea81a6d57419ull, 0x000feaa797de1cefull, 0x000feacc85f3d91full, 0x000feaf07865e63cull,
+            0x000feb13762fec12ull, 0x000feb3585fe2a4aull, 0x000feb56ae3162b4ull, 0x000feb76f4e284f9ull,
+            0x000feb965fe62013ull, 0x000febb4f4cf9d7cull, 0x000febd2b8f449cfull, 0x000febefb16e2e3dull,
+            0x000fec0be31ebde8ull, 0x000fec2752b15a14ull, 0x000fec42049dafd3ull, 0x000fec5bfd29f196ull,
+            0x000fec75406ceef4ull, 0x000fec8dd2500cb4ull, 0x000feca5b6911f10ull, 0x000fecbcf0c427feull,
+            0x000fecd38454fb15ull, 0x000fece97488c8b3ull, 0x000fecfec47f91b7ull, 0x000fed1377358528ull,
+            0x000fed278f844903ull, 0x000fed3b10242f4cull, 0x000fed4dfbad586dull, 0x000fed605498c3dcull,
+            0x000fed721d414fe8ull, 0x000fed8357e4a981ull, 0x000fed9406a42cc8ull, 0x000feda42b85b704ull,
+            0x000fedb3c8746ab3ull, 0x000fedc2df416652ull, 0x000fedd171a46e52ull, 0x000feddf813c8ad2ull,
+            0x000feded0f90997full, 0x000fedfa1e0fd413ull, 0x000fee06ae124bc4ull, 0x000fee12c0d95a06ull,
+            0x000fee1e579006dfull, 0x000fee29734b6524ull, 0x000fee34150ae4bbull, 0x000fee3e3db89b3cull,
+            0x000fee47ee2982f3ull, 0x000fee51271db086ull, 0x000fee59e9407f41ull, 0x000fee623528b42dull,
+            0x000fee6a0b5897f0ull, 0x000fee716c3e077aull, 0x000fee7858327b81ull, 0x000fee7ecf7b06b9ull,
+            0x000fee84d2484ab2ull, 0x000fee8a60b66342ull, 0x000fee8f7accc851ull, 0x000fee94207e25daull,
+            0x000fee9851a829ebull, 0x000fee9c0e13485bull, 0x000fee9f557273f3ull, 0x000feea22762ccaeull,
+            0x000feea4836b42abull, 0x000feea668fc2d71ull, 0x000feea7d76ed6f9ull, 0x000feea8ce04fa0aull,
+            0x000feea94be8333bull, 0x000feea95029640full, 0x000feea8d9c0075dull, 0x000feea7e7897653ull,
+            0x000feea678481d24ull, 0x000feea48aa29e82ull, 0x000feea21d22e4d9ull, 0x000fee9f2e352024ull,
+            0x000fee9bbc26af2eull, 0x000fee97c524f2e3ull, 0x000fee93473c0a39ull, 0x000fee8e40557515ull,
+            0x000fee88ae369c79ull, 0x000fee828e7f3dfcull, 0x000fee7bdea7b887ull, 0x000fee749bff37ffull,
+            0x000fee6cc3a9bd5eull, 0x000fee64529e007full, 0x000fee5b45a32888ull, 0x000fee51994e57b5ull,
+            0x000fee474a0006ceull, 0x000fee3c53e12c4full, 0x000fee30b2e02ad7ull, 0x000fee2462ad8204ull,
+            0x000fee175eb83c59ull, 0x000fee09a22a1447ull, 0x000fedfb27e349cbull, 0x000fedebea76216cull,
+            0x000feddbe422047dull, 0x000fedcb0ece39d3ull, 0x000fedb964042cf3ull, 0x000feda6dce938c9ull,
+            0x000fed937237e98cull, 0x000fed7f1c38a836ull, 0x000fed69d2b9c02aull, 0x000fed538d06adffull,
+            0x000fed3c41dea422ull, 0x000fed23e76a2fd7ull, 0x000fed0a732fe643ull, 0x000fecefda07fe33ull,
+            0x000fecd4100eb7b8ull, 0x000fecb708956eb4ull, 0x000fec98b61230c0ull, 0x000fec790a0da978ull,
+            0x000fec57f50f31fdull, 0x000fec356686c961ull, 0x000fec114cb4b334ull, 0x000febeb948e6fd0ull,
+            0x000febc429a0b691ull, 0x000feb9af5ee0cdcull, 0x000feb6fe1c98542ull, 0x000feb42d3ad1f9eull,
+            0x000feb13b00b2d4bull, 0x000feae2591a02e8ull, 0x000feaaeae992256ull, 0x000fea788d8ee326ull,
+            0x000fea3fcffd73e5ull, 0x000fea044c8dd9f6ull, 0x000fe9c5d62f563aull, 0x000fe9843ba947a3ull,
+            0x000fe93f471d4728ull, 0x000fe8f6bd76c5d6ull, 0x000fe8aa5dc4e8e6ull, 0x000fe859e07ab1eaull,
+            0x000fe804f690a93full, 0x000fe7ab488233bfull, 0x000fe74c751f6aa5ull, 0x000fe6e8102aa201ull,
+            0x000fe67da0b6abd8ull, 0x000fe60c9f38307dull, 0x000fe5947338f742ull, 0x000fe51470977280ull,
+            0x000fe48bd436f457ull, 0x000fe3f9bffd1e37ull, 0x000fe35d35eeb19bull, 0x000fe2b5122fe4fdull,
+            0x000fe20003995557ull, 0x000fe13c82788314ull, 0x000fe068c4ee67afull, 0x000fdf82b02b71aaull,
+            0x000fde87c57efeaaull, 0x000fdd7509c63bfdull, 0x000fdc46e529bf12ull, 0x000fdaf8f82e0282ull,
+            0x000fd985e1b2ba75ull, 0x000fd7e6ef48cf04ull, 0x000fd613adbd650bull, 0x000fd40149e2f011ull,
+            0x000fd1a1a7b4c7acull, 0x000fcee204761f9eull, 0x000fcba8d85e11b1ull, 0x000fc7d26ecd2d22ull,
+            0x000fc32b2f1e22ecull, 0x000fbd6581c0b839ull, 0x000fb606c4005433ull, 0x000fac40582a2873ull,
+            0x000f9e971e014597ull, 0x000f89fa48a41dfbull, 0x000f66c5f7f0302cull, 0x000f1a5a4b331c49ull
+        };
+
+        inline constexpr std::array<double, 256> NORMAL_W{
+            8.683627060801315e-16, 4.779330175727774e-17, 6.354352417405284e-17, 7.454870481247716e-17,
+            8.329366815793117e-17, 9.068060405059501e-17, 9.714860076567782e-17, 1.0294750314241035e-16,
+            1.08234302884477e-16, 1.1311470196109048e-16, 1.1766359457022938e-16, 1.2193617278714378e-16,
+            1.2597439914637105e-16, 1.2981099886264044e-16, 1.3347203736824135e-16, 1.3697864842571216e-16,
+            1.4034823001242394e-16, 1.4359529452056958e-16, 1.4673208742364434e-16, 1.4976904668391052e-16,
+            1.5271515003596215e-16, 1.555781816946078e-16, 1.58364940092909e-16, 1.6108140175274945e-16,
+            1.637328520396987e-16, 1.663239905842085e-16, 1.688590170867661e-16, 1.7134170176559673e-16,
+            1.7377544365864874e-16, 1.761633192300101e-16, 1.7850812316976745e-16, 1.8081240285799165e-16,
+            1.8307848764826765e-16, 1.8530851388618034e-16, 1.8750444639373896e-16, 1.8966809700774774e-16,
+            1.9180114064838635e-16, 1.939051293062512e-16, 1.9598150426628837e-16, 1.9803160683128186e-16,
+            2.000566877627334e-16, 2.0205791562071661e-16, 2.0403638415480222e-16, 2.0599311887403719e-16,
+            2.0792908290414027e-16, 2.0984518222370362e-16, 2.1174227035760352e-16, 2.1362115259449878e-16,
+            2.1548258978581468e-16, 2.1732730177564377e-16, 2.191559705042728e-16, 2.209692428223533e-16,
+            2.2276773304789563e-16, 2.245520252941437e-16, 2.2632267559285693e-16, 2.280802138345019e-16,
+            2.2982514554424704e-16, 2.315579535104082e-16, 2.3327909928004376e-16, 2.3498902453470975e-16,
+            2.366881523579162e-16, 2.383768884045426e-16, 2.4005562198135073e-16, 2.4172472704675035e-16,
+            2.4338456313711043e-16, 2.450354762261497e-16, 2.466777995232707e-16, 2.483118542161089e-16,
+            2.4993795016204544e-16, 2.5155638653296593e-16, 2.5316745241713597e-16, 2.5477142738169457e-16,
+            2.563685819989398e-16, 2.579591783392868e-16, 2.595434704335171e-16, 2.6112170470670204e-16,
+            2.6269412038597266e-16, 2.642609498841191e-16, 2.6582241916083083e-16, 2.673787480632365e-16,
+            2.689301506472617e-16, 2.704768354811996e-16, 2.7201900593277335e-16, 2.7355686044086806e-16,
+            2.750905927730168e-16, 2.7662039226963913e-16, 2.781464440759545e-16, 2.796689293624231e-16,
+            2.8118802553450217e-16, 2.8270390643244797e-16, 2.842167425218407e-16, 2.857267010754602e-16,
+            2.8723394634709804e-16, 2.8873863973784824e-16, 2.902409399553843e-16, 2.917410031666946e-16,
+            2.9323898314471826e-16, 2.9473503140929354e-16, 2.962292973628067e-16, 2.9772192842090294e-16,
+            2.9921307013860136e-16, 3.0070286633213315e-16, 3.0219145919680625e-16, 3.0367898942118023e-16,
+            3.0516559629782197e-16, 3.0665141783089555e-16, 3.081365908408298e-16, 3.0962125106629235e-16,
+            3.111055332636894e-16, 3.125895713044e-16, 3.140734982699447e-16, 3.1555744654528016e-16,
+            3.1704154791040295e-16, 3.1852593363044075e-16, 3.200107345444012e-16, 3.2149608115274475e-16,
+            3.229821037039416e-16, 3.2446893228016983e-16, 3.259566968823079e-16, 3.274455275143707e-16,
+            3.28935554267537e-16, 3.304269074039129e-16, 3.3191971744017523e-16, 3.3341411523123725e-16,
+            3.349102320540779e-16, 3.3640819969187656e-16, 3.3790815051859503e-16, 3.39410217584149e-16,
+            3.4091453470031265e-16, 3.4242123652750187e-16, 3.439304586625832e-16, 3.4544233772785845e-16,
+            3.4695701146137845e-16, 3.4847461880874147e-16, 3.499953000165382e-16, 3.515191967276075e-16,
+            3.5304645207827406e-16, 3.5457721079774367e-16, 3.5611161930983894e-16, 3.5764982583726515e-16,
+            3.5919198050860314e-16, 3.607382354682353e-16, 3.6228874498941935e-16, 3.638436655907346e-16,
+            3.6540315615613714e-16, 3.6696737805887024e-16, 3.685364952894915e-16, 3.7011067458828993e-16,
+            3.7169008558238235e-16, 3.7327490092779445e-16, 3.748652964568489e-16, 3.764614513312029e-16,
+            3.780635482008961e-16, 3.7967177336979448e-16, 3.812863169678378e-16, 3.8290737313052437e-16,
+            3.8453514018609596e-16, 3.8616982085091493e-16, 3.8781162243355867e-16, 3.894607570481926e-16,
+            3.9111744183782054e-16, 3.927818992080542e-16, 3.944543570720877e-16, 3.9613504910761354e-16,
+            3.9782421502646826e-16, 3.995221008578565e-16, 4.012289592460629e-16, 4.029450497636328e-16,
+            4.04670639241075e-16, 4.0640600211422504e-16, 4.0815142079049387e-16, 4.099071860353266e-16,
+            4.1167359738030247e-16, 4.134509635544235e-16, 4.152396029402687e-16, 4.1703984405683144e-16,
+            4.188520260710111e-16, 4.206764993399014e-16, 4.2251362598620484e-16, 4.2436378050930775e-16,
+            4.262273504347798e-16, 4.2810473700531167e-16, 4.2999635591638323e-16, 4.3190263810026294e-16,
+            4.338240305622791e-16, 4.357609972736849e-16, 4.3771402012585875e-16, 4.3968359995105214e-16,
+            4.4167025761542035e-16, 4.4367453519065673e-16, 4.456969972112043e-16, 4.477382320247534e-16,
+            4.49798853244555e-16, 4.518795013130059e-16, 4.539808451870034e-16, 4.561035841567423e-16,
+            4.582484498109568e-16, 4.604162081631154e-16, 4.626076619547847e-16, 4.648236531543208e-16,
+            4.670650656712633e-16, 4.69332828309333e-16, 4.716279179838353e-16, 4.739513632325869e-16,
+            4.763042480533139e-16, 4.786877161048725e-16, 4.811029753147419e-16, 4.835513029411527e-16,
+            4.860340511450813e-16, 4.885526531353604e-16, 4.911086299595271e-16, 4.937035980240336e-16,
+            4.963392774403987e-16, 4.990175013091822e-16, 5.01740226071809e-16, 5.045095430818728e-16,
+            5.073276915733542e-16, 5.101970732341562e-16, 5.131202686306784e-16, 5.161000557743228e-16,
+            5.1913943117577e-16, 5.222416338000234e-16, 5.254101724177597e-16, 5.286488569504945e-16,
+            5.3196183453384e-16, 5.353536311816497e-16, 5.388292001334053e-16, 5.423939782201712e-16,
+            5.46053951907478e-16, 5.498157350892814e-16, 5.536866612467876e-16, 5.576748932926577e-16,
+            5.617895553555417e-16, 5.660408920082423e-16, 5.70440462129139e-16, 5.750013768919896e-16,
+            5.797385945724595e-16, 5.84669289345548e-16, 5.8981331764779e-16, 5.951938149641445e-16,
+            6.008379696271908e-16, 6.067780409333449e-16, 6.130527208725281e-16, 6.197089894581626e-16,
+            6.268046963301283e-16, 6.344122407127505e-16, 6.426239659548054e-16, 6.515603317344993e-16,
+            6.613827885097663e-16, 6.723150462505586e-16, 6.846803417564259e-16, 6.98971833638762e-16,
+            7.159994934830663e-16, 7.372424301798798e-16, 7.658936370805572e-16, 8.113849337656484e-16
+        };
+
+        inline constexpr std::array<double, 256> NORMAL_F{
+            1.0, 0.9771017012676713, 0.9598790918001063, 0.9451989534422993,
+            0.9320600759592301, 0.9199915050393467, 0.9087264400521305, 0.8980959218983431,
+            0.887984660755833, 0.8783096558089171, 0.8690086880368567, 0.8600336211963312,
+            0.8513462584586777, 0.842915653112204, 0.8347162929868832, 0.826726833946221,
+            0.818929191603702, 0.8113078743126559, 0.8038494831709639, 0.7965423304229586,
+            0.7893761435660241, 0.7823418326548021, 0.7754313049811867, 0.7686373157984858,
+            0.7619533468367949, 0.7553735065070958, 0.7488924472191565, 0.7425052963401507,
+            0.7362075981268623, 0.7299952645614758, 0.7238645334686298, 0.7178119326307216,
+            0.7118342488782481, 0.7059285013327539, 0.7000919181365113, 0.6943219161261164,
+            0.6886160830046714, 0.6829721616449944, 0.6773880362187731, 0.6718617198970818,
+            0.6663913439087499, 0.6609751477766629, 0.655611470579697, 0.6502987431108165,
+            0.6450354808208221, 0.6398202774530563, 0.6346517992876233, 0.6295287799248364,
+            0.6244500155470262, 0.6194143606058341, 0.6144207238889136, 0.6094680649257731,
+            0.6045553906974674, 0.5996817526191249, 0.594846243767987, 0.5900479963328256,
+            0.5852861792633709, 0.5805599961007905, 0.5758686829723533, 0.5712115067352528,
+            0.566587763256164, 0.561996775814524, 0.5574378936187656, 0.552910490425832,
+            0.5484139632552655, 0.5439477311900258, 0.5395112342569517, 0.5351039323804572,
+            0.5307253044036616, 0.526374847171684, 0.5220520746723215, 0.5177565172297559,
+            0.5134877207473266, 0.5092452459957476, 0.5050286679434679, 0.5008375751261485,
+            0.4966715690524894, 0.4925302636438682, 0.48841328470545764, 0.48432026942668294,
+            0.4802508659090465, 0.47620473271950553, 0.4721815384677298, 0.46818096140569326,
+            0.464202689048174, 0.46024641781284253, 0.45631185267871616, 0.4523987068618483,
+            0.4485067015072028, 0.4446355653957392, 0.4407850346658038, 0.4369548525479854,
+            0.43314476911265215, 0.4293545410294413, 0.42558393133802186, 0.4218327092294958,
+            0.418100649837848, 0.41438753404089096, 0.41069314827018805, 0.4070172843294732,
+            0.40335973922111434, 0.39972031498019706, 0.39609881851583223, 0.3924950614593154,
+            0.3889088600187886, 0.3853400348400771, 0.38178841087339344, 0.37825381724561896,
+            0.3747360871378909, 0.3712350576682393, 0.3677505697790323, 0.3642824681290038,
+            0.3608306009896478, 0.3573948201457803, 0.3539749808000766, 0.35057094148140594,
+            0.34718256395679353, 0.3438097131468506, 0.3404522570445217, 0.33711006663700593,
+            0.3337830158307183, 0.3304709813791634, 0.32717384281360135, 0.3238914823763911,
+            0.32062378495690536, 0.3173706380299135, 0.3141319315963371, 0.31090755812628634,
+            0.30769741250429195, 0.3045013919766498, 0.30131939610080294, 0.29815132669668537,
+            0.2949970877999617, 0.29185658561709504, 0.28872972848218276, 0.2856164268155016,
+            0.28251659308370747, 0.2794301417616378, 0.2763569892956681, 0.2732970540685769,
+            0.27025025636587524, 0.26721651834356114, 0.2641957639972608, 0.2611879191327209,
+            0.25819291133761896, 0.2552106699546617, 0.25224112605594196, 0.24928421241852827,
+            0.24633986350126366, 0.24340801542275015, 0.24048860594050042, 0.23758157443123798,
+            0.23468686187232993, 0.2318044108243386, 0.22893416541468026, 0.22607607132238022,
+            0.22323007576391746, 0.22039612748015197, 0.21757417672433116, 0.2147641752511736,
+            0.21196607630703018, 0.20917983462112502, 0.20640540639788074, 0.20364274931033488,
+            0.2008918224946566, 0.19815258654577514, 0.19542500351413428, 0.19270903690358915,
+            0.19000465167046499, 0.18731181422380028, 0.18463049242679927, 0.18196065559952257,
+            0.17930227452284767, 0.176655321443735, 0.17401977008183878, 0.17139559563750595,
+            0.1687827748012115, 0.16618128576448207, 0.16359110823236572, 0.1610122234375111,
+            0.1584446141559243, 0.15588826472447923, 0.15334316106026286, 0.1508092906818457,
+            0.14828664273257455, 0.14577520800599406, 0.14327497897351343, 0.1407859498144447,
+            0.13830811644855073, 0.13584147657125373, 0.13338602969166913, 0.13094177717364433,
+            0.12850872227999954, 0.12608687022018586, 0.12367622820159656, 0.12127680548479022,
+            0.11888861344290999, 0.11651166562561081, 0.11414597782783836, 0.111791568163838,
+            0.10944845714681165, 0.10711666777468365, 0.1047962256224869, 0.1024871589419351,
+            0.10018949876880982, 0.0979032790388623, 0.09562853671300883, 0.09336531191269087,
+            0.09111364806637363, 0.0888735920682758, 0.08664519445055796, 0.08442850957035337,
+            0.08222359581320286, 0.08003051581466306, 0.07784933670209605, 0.07568013035892708,
+            0.07352297371398127, 0.07137794905889037, 0.06924514439700677, 0.0671246538277885,
+            0.06501657797124286, 0.06292102443775813, 0.060838108349539864, 0.058767952920933765,
+            0.0567106901062029, 0.05466646132488892, 0.05263541827679218, 0.05061772386094777,
+            0.04861355321586853, 0.04662309490193037, 0.04464655225129445, 0.04268414491647444,
+            0.04073611065594093, 0.03880270740452612, 0.03688421568856729, 0.034980941461716084,
+            0.03309321945857852, 0.03122141719192025, 0.029365939758133317, 0.027527235669603085,
+            0.025705804008548896, 0.023902203305795882, 0.022117062707308868, 0.02035109623004452,
+            0.018605121275724647, 0.01688008315254317, 0.015177088307935327, 0.01349745060173988,
+            0.01184275785790789, 0.010214971439701471, 0.008616582769398732, 0.007050875471373227,
+            0.005522403299250998, 0.0040379725933630305, 0.002609072746102163, 0.0012602859304985975
+        };
+
+
+        //---   Exponential distribution   ----------------------------------
+        // notice: random integers are 53-bits wide
+        inline constexpr double EXPO_R{ 7.69711747013105 };  // i.e. the right-most abscissa of base layer
+
+        inline constexpr std::array<std::uint64_t, 256> EXPO_K{
+            0x001c5214272497c7ull, 0x0000000000000000ull, 0x00137d5bd79c317full, 0x00186ef58e3f3c10ull,
+            0x001a9bb7320eb0aeull, 0x001bd127f719447cull, 0x001c951d0f88651bull, 0x001d1bfe2d5c3973ull,
+            0x001d7e5bd56b18b3ull, 0x001dc934dd172c71ull, 0x001e0409dfac9dc9ull, 0x001e337b71d47837ull,
+            0x001e5a8b177cb7a3ull, 0x001e7b42096f046cull, 0x001e970daf08ae3eull, 0x001eaef5b14ef09eull,
+            0x001ec3bd07b46557ull, 0x001ed5f6f08799ceull, 0x001ee614ae6e5688ull, 0x001ef46eca361cd0ull,
+            0x001f014b76ddd4a4ull, 0x001f0ce313a796b7ull, 0x001f176369f1f77aull, 0x001f20f20c452571ull,
+            0x001f29ae1951a874ull, 0x001f31b18fb95532ull, 0x001f39125157c106ull, 0x001f3fe2eb6e694cull,
+            0x001f463332d788fbull, 0x001f4c10bf1d3a0full, 0x001f51874c5c3322ull, 0x001f56a109c3ecc0ull,
+            0x001f5b66d9099996ull, 0x001f5fe08210d08cull, 0x001f6414dd445772ull, 0x001f6809f6859679ull,
+            0x001f6bc52a2b02e7ull, 0x001f6f4b3d32e4f4ull, 0x001f72a07190f13aull, 0x001f75c8974d09d7ull,
+            0x001f78c71b045cc0ull, 0x001f7b9f12413ff5ull, 0x001f7e5346079f8aull, 0x001f80e63be21139ull,
+            0x001f835a3dad9162ull, 0x001f85b16056b913ull, 0x001f87ed89b24262ull, 0x001f8a10759374faull,
+            0x001f8c1bba3d39adull, 0x001f8e10cc45d04aull, 0x001f8ff102013e17ull, 0x001f91bd968358e1ull,
+            0x001f9377ac47afd8ull, 0x001f95204f8b64dbull, 0x001f96b878633892ull, 0x001f98410c968892ull,
+            0x001f99bae146ba81ull, 0x001f9b26bc697f00ull, 0x001f9c85561b717aull, 0x001f9dd759cfd803ull,
+            0x001f9f1d6761a1ceull, 0x001fa058140936c0ull, 0x001fa187eb3a3339ull, 0x001fa2ad6f6bc4fcull,
+            0x001fa3c91ace0683ull, 0x001fa4db5fee6aa3ull, 0x001fa5e4aa4d097dull, 0x001fa6e55ee46783ull,
+            0x001fa7dddca51ec4ull, 0x001fa8ce7ce6a875ull, 0x001fa9b793ce5fefull, 0x001faa9970adb858ull,
+            0x001fab745e588232ull, 0x001fac48a3740585ull, 0x001fad1682bf9fe9ull, 0x001fadde3b5782c1ull,
+            0x001faea008f21d6dull, 0x001faf5c2418b07eull, 0x001fb012c25b7a13ull, 0x001fb0c41681dff4ull,
+            0x001fb17050b6f1fbull, 0x001fb2179eb2963aull, 0x001fb2ba2bdfa84bull, 0x001fb358217f4e18ull,
+            0x001fb3f1a6c9be0cull, 0x001fb486e10cacd7ull, 0x001fb517f3c793fdull, 0x001fb5a500c5fdaaull,
+            0x001fb62e2837fe59ull, 0x001fb6b388c9010aull, 0x001fb7353fb50799ull, 0x001fb7b368dc7da8ull,
+            0x001fb82e1ed6ba09ull, 0x001fb8a57b0347f6ull, 0x001fb919959a0f74ull, 0x001fb98a85ba7204ull,
+            0x001fb9f861796f27ull, 0x001fba633deee286ull, 0x001fbacb2f41ec17ull, 0x001fbb3048b49145ull,
+            0x001fbb929caea4e2ull, 0x001fbbf23cc8029eull, 0x001fbc4f39d22995ull, 0x001fbca9a3e140d5ull,
+            0x001fbd018a548f9full, 0x001fbd56fbde729cull, 0x001fbdaa068bd66bull, 0x001fbdfab7cb3f41ull,
+            0x001fbe491c7364deull, 0x001fbe9540c9695full, 0x001fbedf3086b128ull, 0x001fbf26f6de6175ull,
+            0x001fbf6c9e828ae3ull, 0x001fbfb031a904c4ull, 0x001fbff1ba0ffdb0ull, 0x001fc03141024589ull,
+            0x001fc06ecf5b54b3ull, 0x001fc0aa6d8b1427ull, 0x001fc0e42399698aull, 0x001fc11bf9298a64ull,
+            0x001fc151f57d1943ull, 0x001fc1861f770f4bull, 0x001fc1b87d9e74b4ull, 0x001fc1e91620ea43ull,
+            0x001fc217eed505deull, 0x001fc2450d3c83ffull, 0x001fc27076864fc2ull, 0x001fc29a2f90630full,
+            0x001fc2c23ce98046ull, 0x001fc2e8a2d2c6b4ull, 0x001fc30d654122edull, 0x001fc33087de9c0full,
+            0x001fc3520e0b7ec7ull, 0x001fc371fadf66f8ull, 0x001fc390512a2887ull, 0x001fc3ad137497faull,
+            0x001fc3c844013349ull, 0x001fc3e1e4ccab40ull, 0x001fc3f9f78e4da8ull, 0x001fc4107db85061ull,
+            0x001fc4257877fd68ull, 0x001fc438e8b5bfc7ull, 0x001fc44acf15112aull, 0x001fc45b2bf447e8ull,
+            0x001fc469ff6c4504ull, 0x001fc477495001b2ull, 0x001fc483092bfbb9ull, 0x001fc48d3e457ff6ull,
+            0x001fc495e799d21bull, 0x001fc49d03dd30b1ull, 0x001fc4a29179b433ull, 0x001fc4a68e8e07fcull,
+            0x001fc4a8f8ebfb8cull, 0x001fc4a9ce16ea9full, 0x001fc4a90b41fa34ull, 0x001fc4a6ad4e28a0ull,
+            0x001fc4a2b0c82e75ull, 0x001fc49d11e62de3ull, 0x001fc495cc852df5ull, 0x001fc48cdc265ec1ull,
+            0x001fc4823bec237aull, 0x001fc475e696dee6ull, 0x001fc467d6817e83ull, 0x001fc458059dc037ull,
+            0x001fc4466d702e21ull, 0x001fc433070bcb99ull, 0x001fc41dcb0d6e0eull, 0x001fc406b196bbf7ull,
+            0x001fc3edb248cb62ull, 0x001fc3d2c43e593cull, 0x001fc3b5de0591b4ull, 0x001fc396f599614cull,
+            0x001fc376005a4593ull, 0x001fc352f3069371ull, 0x001fc32dc1b22819ull, 0x001fc3065fbd7888ull,
+            0x001fc2dcbfcbf263ull, 0x001fc2b0d3b99f9eull, 0x001fc2828c8ffcf0ull, 0x001fc251da79f164ull,
+            0x001fc21eacb6d39eull, 0x001fc1e8f18c6756ull, 0x001fc1b09637bb3cull, 0x001fc17586dccd10ull,
+            0x001fc137ae74d6b7ull, 0x001fc0f6f6bb2415ull, 0x001fc0b348184da4ull, 0x001fc06c898baff1ull,
+            0x001fc022a092f365ull, 0x001fbfd5710f72b9ull, 0x001fbf84dd29488full, 0x001fbf30c52fc60bull,
+            0x001fbed907770cc6ull, 0x001fbe7d80327ddbull, 0x001fbe1e094ba614ull, 0x001fbdba7a354408ull,
+            0x001fbd52a7b9f826ull, 0x001fbce663c6201bull, 0x001fbc757d2c4de5ull, 0x001fbbffbf63b7aaull,
+            0x001fbb84f23fe6a2ull, 0x001fbb04d9a0d18dull, 0x001fba7f351a70adull, 0x001fb9f3bf92b619ull,
+            0x001fb9622ed4abfcull, 0x001fb8ca33174a17ull, 0x001fb82b76765b54ull, 0x001fb7859c5b895cull,
+            0x001fb6d840d55594ull, 0x001fb622f7d96943ull, 0x001fb5654c6f37e1ull, 0x001fb49ebfbf69d2ull,
+            0x001fb3cec803e747ull, 0x001fb2f4cf539c3full, 0x001fb21032442853ull, 0x001fb1203e5a9604ull,
+            0x001fb0243042e1c2ull, 0x001faf1b31c479a7ull, 0x001fae045767e105ull, 0x001facde9dbf2d73ull,
+            0x001faba8e640060bull, 0x001faa61f399ff28ull, 0x001fa908656f66a2ull, 0x001fa79ab3508d3dull,
+            0x001fa61726d1f214ull, 0x001fa47bd48bea00ull, 0x001fa2c693c5c095ull, 0x001fa0f4f47df315ull,
+            0x001f9f04336bbe0bull, 0x001f9cf12b79f9bdull, 0x001f9ab84415abc5ull, 0x001f98555b782fb9ull,
+            0x001f95c3abd03f79ull, 0x001f92fda9cef1f3ull, 0x001f8ffcda9ae41dull, 0x001f8cb99e7385f8ull,
+            0x001f892aec479607ull, 0x001f8545f904db8full, 0x001f80fdc336039bull, 0x001f7c427839e926ull,
+            0x001f7700a3582accull, 0x001f71200f1a241cull, 0x001f6a8234b7352bull, 0x001f630000a8e267ull,
+            0x001f5a66904fe3c4ull, 0x001f50724ece1172ull, 0x001f44c7665c6fdbull, 0x001f36e5a38a59a2ull,
+            0x001f26143450340aull, 0x001f113e047b0414ull, 0x001ef6aefa57cbe7ull, 0x001ed38ca188151eull,
+            0x001ea2a61e122db1ull, 0x001e5961c78b267cull, 0x001dddf62bac0bb1ull, 0x001cdb4dd9e4e8c0ull
+        };
+
+        inline constexpr std::array<double, 256> EXPO_W{
+            9.655740063209183e-16, 7.089014243955414e-18, 1.1639412496691224e-17, 1.524391512353216e-17,
+            1.833284885723744e-17, 2.1089651094644866e-17, 2.3611280778431382e-17, 2.595595772310894e-17,
+            2.8161735541977523e-17, 3.0255041303213823e-17, 3.225508254836375e-17, 3.417632340185027e-17,
+            3.6029969787344525e-17, 3.782490776869649e-17, 3.956832198097553e-17, 4.1266117781759464e-17,
+            4.2923218084425256e-17, 4.4543777432823714e-17, 4.613133981483186e-17, 4.768895725264636e-17,
+            4.921928043727963e-17, 5.072462904503147e-17, 5.220704702792672e-17, 5.366834661718192e-17,
+            5.511014372835095e-17, 5.653388673239667e-17, 5.794088004852767e-17, 5.933230365208943e-17,
+            6.07092293284718e-17, 6.207263431163193e-17, 6.342341280303077e-17, 6.476238575956142e-17,
+            6.609030925769405e-17, 6.740788167872722e-17, 6.871574991183812e-17, 7.00145147340393e-17,
+            7.130473549660643e-17, 7.258693422414648e-17, 7.386159921381792e-17, 7.512918820723728e-17,
+            7.639013119550826e-17, 7.764483290797848e-17, 7.88936750272979e-17, 8.013701816675454e-17,
+            8.137520364041762e-17, 8.260855505210038e-17, 8.383737972539139e-17, 8.506196999385323e-17,
+            8.628260436784113e-17, 8.749954859216183e-17, 8.871305660690252e-17, 8.992337142215357e-17,
+            9.113072591597909e-17, 9.233534356381788e-17, 9.353743910649129e-17, 9.47372191631295e-17,
+            9.593488279457997e-17, 9.713062202221521e-17, 9.832462230649511e-17, 9.951706298915072e-17,
+            1.0070811770242949e-16, 1.0189795474846941e-16, 1.030867374515422e-16, 1.0427462448561886e-16,
+            1.0546177017945764e-16, 1.0664832480119147e-16, 1.0783443482419485e-16, 1.0902024317583505e-16,
+            1.1020588947055781e-16, 1.1139151022861975e-16, 1.1257723908165675e-16, 1.1376320696616847e-16,
+            1.1494954230590093e-16, 1.1613637118402183e-16, 1.1732381750590458e-16, 1.1851200315326694e-16,
+            1.1970104813034652e-16, 1.2089107070273855e-16, 1.2208218752947062e-16, 1.2327451378884152e-16,
+            1.2446816329851125e-16, 1.2566324863028985e-16, 1.2685988122003975e-16, 1.2805817147307494e-16,
+            1.2925822886541196e-16, 1.3046016204120288e-16, 1.3166407890665726e-16, 1.328700867207381e-16,
+            1.3407829218289994e-16, 1.3528880151811755e-16, 1.3650172055943978e-16, 1.377171548282881e-16,
+            1.389352096127064e-16, 1.4015599004375715e-16, 1.4137960117024852e-16, 1.4260614803196654e-16,
+            1.4383573573157902e-16, 1.4506846950536877e-16, 1.4630445479294757e-16, 1.4754379730609516e-16,
+            1.487866030968626e-16, 1.500329786250737e-16, 1.5128303082535394e-16, 1.5253686717381255e-16,
+            1.537945957544997e-16, 1.5505632532575771e-16, 1.5632216538658375e-16, 1.5759222624311761e-16,
+            1.5886661907536842e-16, 1.6014545600429167e-16, 1.6142885015932787e-16, 1.6271691574651305e-16,
+            1.640097681172718e-16, 1.653075238380037e-16, 1.666103007605742e-16, 1.6791821809382289e-16,
+            1.6923139647620223e-16, 1.7054995804966298e-16, 1.7187402653490317e-16, 1.7320372730810084e-16,
+            1.745391874792534e-16, 1.7588053597224914e-16, 1.7722790360680065e-16, 1.7858142318237326e-16,
+            1.7994122956424637e-16, 1.8130745977185016e-16, 1.8268025306952523e-16, 1.8405975105985878e-16,
+            1.8544609777975695e-16, 1.8683943979941927e-16, 1.882399263243892e-16, 1.8964770930086167e-16,
+            1.9106294352443765e-16, 1.9248578675252438e-16, 1.9391639982058994e-16, 1.9535494676249091e-16,
+            1.9680159493510374e-16, 1.982565151475019e-16, 1.997198817949342e-16, 2.0119187299787347e-16,
+            2.0267267074641983e-16, 2.0416246105035888e-16, 2.0566143409519179e-16, 2.071697844044737e-16,
+            2.0868771100881597e-16, 2.1021541762192928e-16, 2.117531128241076e-16, 2.133010102535779e-16,
+            2.1485932880616633e-16, 2.1642829284376047e-16, 2.180081324120784e-16, 2.1959908346828707e-16,
+            2.212013881190496e-16, 2.2281529486961805e-16, 2.2444105888463086e-16, 2.2607894226131737e-16,
+            2.277292143158621e-16, 2.2939215188373114e-16, 2.3106803963482133e-16, 2.3275717040435346e-16,
+            2.344598455404958e-16, 2.361763752697774e-16, 2.3790707908142767e-16, 2.3965228613186235e-16,
+            2.4141233567062933e-16, 2.431875774892256e-16, 2.44978372394307e-16, 2.4678509270692887e-16,
+            2.4860812278958517e-16, 2.504478596029557e-16, 2.523047132944217e-16, 2.541791078205812e-16,
+            2.560714816061771e-16, 2.579822882420531e-16, 2.599119972249747e-16, 2.618610947423924e-16,
+            2.638300845054943e-16, 2.658194886341845e-16, 2.678298485979525e-16, 2.698617262169489e-16,
+            2.7191570472798185e-16, 2.739923899205815e-16, 2.760924113487617e-16, 2.782164236246436e-16,
+            2.8036510780069835e-16, 2.825391728480253e-16, 2.847393572388174e-16, 2.8696643064198177e-16,
+            2.8922119574179956e-16, 2.915044901905293e-16, 2.9381718870700286e-16, 2.9616020533454657e-16,
+            2.9853449587300453e-16, 3.009410605012618e-16, 3.0338094660850034e-16, 3.058552518544861e-16,
+            3.08365127481531e-16, 3.1091178190342663e-16, 3.134964845996663e-16, 3.1612057034671057e-16,
+            3.187854438219713e-16, 3.2149258462067974e-16, 3.2424355273094516e-16, 3.2703999451822404e-16,
+            3.298836492772283e-16, 3.3277635641716714e-16, 3.357200633553244e-16, 3.387168342045505e-16,
+            3.417688593525637e-16, 3.448784660453424e-16, 3.4804813010374423e-16, 3.5128048892229794e-16,
+            3.545783559224792e-16, 3.5794473666042765e-16, 3.6138284682190606e-16, 3.6489613237645425e-16,
+            3.6848829220956213e-16, 3.7216330360802073e-16, 3.7592545104162565e-16, 3.7977935876688744e-16,
+            3.8373002787892137e-16, 3.8778287856078953e-16, 3.919437984311429e-16, 3.962191980786775e-16,
+            4.0061607510565417e-16, 4.051420882956573e-16, 4.0980564389030625e-16, 4.1461599642909046e-16,
+            4.195833672073399e-16, 4.247190841824385e-16, 4.3003574816674707e-16, 4.355474314693952e-16,
+            4.41269916903607e-16, 4.472209874259932e-16, 4.534207798565834e-16, 4.598922204905932e-16,
+            4.666615664711476e-16, 4.737590853262492e-16, 4.812199172829238e-16, 4.89085182739221e-16,
+            4.97403423619194e-16, 5.06232507214416e-16, 5.156421828878083e-16, 5.257175802022275e-16,
+            5.365640977112022e-16, 5.483144034258704e-16, 5.61138745467516e-16, 5.752606481503332e-16,
+            5.909817641652103e-16, 6.087231416180908e-16, 6.290979034877557e-16, 6.530492053564041e-16,
+            6.821393079028929e-16, 7.192444966089362e-16, 7.706095350032097e-16, 8.545517038584027e-16
+        };
+
+        inline constexpr std::array<double, 256> EXPO_F{
+            1.0, 0.9381436808621747, 0.9004699299257465, 0.8717043323812036,
+            0.8477855006239896, 0.8269932966430503, 0.8084216515230084, 0.7915276369724956,
+            0.7759568520401156, 0.7614633888498963, 0.7478686219851951, 0.7350380924314235,
+            0.722867659593572, 0.711274760805076, 0.7001926550827882, 0.689566496117078,
+            0.6793505722647654, 0.6695063167319247, 0.6600008410789997, 0.6508058334145711,
+            0.6418967164272661, 0.6332519942143661, 0.624852738703666, 0.6166821809152077,
+            0.608725382079622, 0.6009689663652322, 0.5934009016917334, 0.586010318477268,
+            0.578787358602845, 0.5717230486648258, 0.5648091929124002, 0.5580382822625874,
+            0.5514034165406413, 0.5448982376724396, 0.5385168720028619, 0.5322538802630433,
+            0.5261042139836197, 0.5200631773682336, 0.5141263938147486, 0.5082897764106429,
+            0.5025495018413477, 0.49690198724154955, 0.49134386959403253, 0.4858719873418849,
+            0.4804833639304542, 0.4751751930373774, 0.46994482528396, 0.4647897562504262,
+            0.4597076156421377, 0.4546961574746155, 0.449753251162755, 0.4448768734145485,
+            0.4400651008423539, 0.4353161032156366, 0.43062813728845883, 0.42599954114303434,
+            0.4214287289976166, 0.4169141864330029, 0.4124544659971612, 0.4080481831520324,
+            0.4036940125305303, 0.3993906844752311, 0.39513698183329016, 0.3909317369847971,
+            0.38677382908413765, 0.38266218149600983, 0.3785957594095808, 0.37457356761590216,
+            0.370594648435146, 0.36665807978151416, 0.3627629733548178, 0.3589084729487498,
+            0.35509375286678746, 0.35131801643748334, 0.347580494621637, 0.3438804447045024,
+            0.34021714906678, 0.3365899140286776, 0.332998068761809, 0.3294409642641363,
+            0.3259179723935562, 0.32242848495608917, 0.31897191284495724, 0.31554768522712895,
+            0.31215524877417955, 0.3087940669345602, 0.30546361924459026, 0.3021634006756935,
+            0.2988929210155818, 0.2956517042812612, 0.2924392881618926, 0.28925522348967775,
+            0.2860990737370768, 0.28297041453878075, 0.2798688332369729, 0.27679392844851736,
+            0.27374530965280297, 0.27072259679906, 0.2677254199320448, 0.2647534188350622,
+            0.261806242689363, 0.25888354974901623, 0.2559850070304154, 0.25311029001562946,
+            0.2502590823688623, 0.24743107566532763, 0.2446259691318921, 0.24184346939887721,
+            0.23908329026244918, 0.23634515245705964, 0.23362878343743335, 0.2309339171696274,
+            0.2282602939307167, 0.22560766011668407, 0.2229757680581202, 0.2203643758433595,
+            0.21777324714870053, 0.21520215107537868, 0.21265086199297828, 0.21011915938898826,
+            0.20760682772422204, 0.2051136562938377, 0.20263943909370902, 0.20018397469191127,
+            0.19774706610509887, 0.19532852067956322, 0.19292814997677135, 0.1905457696631954,
+            0.18818119940425432, 0.1858342627621971, 0.18350478709776746, 0.1811926034754963,
+            0.1788975465724783, 0.17661945459049488, 0.1743581691713535, 0.17211353531532006,
+            0.16988540130252766, 0.1676736186172502, 0.165478041874936, 0.16329852875190182,
+            0.16113493991759203, 0.1589871389693142, 0.15685499236936523, 0.15473836938446808,
+            0.15263714202744286, 0.1505511850010399, 0.1484803756438668, 0.14642459387834494,
+            0.14438372216063478, 0.1423576454324722, 0.14034625107486245, 0.1383494288635802,
+            0.13636707092642886, 0.13439907170221363, 0.13244532790138752, 0.13050573846833077,
+            0.12858020454522817, 0.12666862943751067, 0.12477091858083096, 0.12288697950954514,
+            0.12101672182667483, 0.11916005717532768, 0.11731689921155557, 0.11548716357863353,
+            0.11367076788274431, 0.1118676316700563, 0.11007767640518538, 0.1083008254510338,
+            0.10653700405000166, 0.10478613930657017, 0.10304816017125772, 0.10132299742595363,
+            0.09961058367063713, 0.0979108533114922, 0.0962237425504328, 0.09454918937605586,
+            0.09288713355604354, 0.09123751663104016, 0.08960028191003286, 0.08797537446727022,
+            0.08636274114075691, 0.08476233053236812, 0.08317409300963238, 0.08159798070923742,
+            0.0800339475423199, 0.07848194920160642, 0.0769419431704805, 0.07541388873405841,
+            0.07389774699236475, 0.07239348087570874, 0.07090105516237183, 0.06942043649872875,
+            0.0679515934219366, 0.06649449638533977, 0.06504911778675375, 0.06361543199980733,
+            0.062193415408540995, 0.06078304644547963, 0.059384305633420266, 0.05799717563120066,
+            0.05662164128374288, 0.05525768967669704, 0.05390531019604609, 0.05256449459307169,
+            0.05123523705512628, 0.04991753428270637, 0.0486113855733795, 0.04731679291318155,
+            0.04603376107617517, 0.04476229773294328, 0.04350241356888818, 0.042254122413316234,
+            0.04101744138041482, 0.039792391023374125, 0.03857899550307486, 0.03737728277295936,
+            0.03618728478193142, 0.03500903769739741, 0.03384258215087433, 0.032687963508959535,
+            0.03154523217289361, 0.030414443910466604, 0.029295660224637393, 0.028188948763978636,
+            0.0270943837809558, 0.026012046645134217, 0.024942026419731783, 0.02388442051155817,
+            0.02283933540638524, 0.02180688750428358, 0.020787204072578117, 0.019780424338009743,
+            0.01878670074469603, 0.01780620041091136, 0.016839106826039948, 0.015885621839973163,
+            0.014945968011691148, 0.014020391403181938, 0.013109164931254991, 0.012212592426255381,
+            0.011331013597834597, 0.010464810181029979, 0.00961441364250221, 0.008780314985808975,
+            0.00796307743801704, 0.007163353183634984, 0.006381905937319179, 0.005619642207205483,
+            0.004877655983542392, 0.004157295120833795, 0.003460264777836904, 0.002788798793574076,
+            0.0021459677437189063, 0.0015362997803015724, 0.0009672692823271745, 0.00045413435384149677
+        };
+    }
+
+    /** @}*/
+}
+
+/** @}*/
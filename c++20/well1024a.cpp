@@ -26,6 +26,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
 #include <cstdint>
 
 #include "utils/uint128.h"
@@ -136,3 +137,41 @@ const Well1024a::output_type Well1024a::next() noexcept
 
     return z3;
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Well1024a::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over segments of decreasing indexes
+    // in which none of i-1, i+3, i+24 and i+10 wraps around STATE_SIZE
+    value_type* const list{ _internal_state.state.list.data() };
+    std::uint32_t i{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_low{ i >= 29 ? 29u : i >= 22 ? 22u : i >= 8 ? 8u : i >= 1 ? 1u : 0u };
+        const std::uint32_t d_1{ i >= 1 ? 0u - 1u : STATE_SIZE - 1 };  // notice: unsigned wrap-around makes j + d_1 == j - 1
+        const std::uint32_t d_3{ i < STATE_SIZE - 3 ? 3u : 3u - STATE_SIZE };
+        const std::uint32_t d_24{ i < STATE_SIZE - 24 ? 24u : 24u - STATE_SIZE };
+        const std::uint32_t d_10{ i < STATE_SIZE - 10 ? 10u : 10u - STATE_SIZE };
+
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(i - segment_low + 1, remaining)) };
+        for (std::uint32_t k = 0, j = i; k < count; ++k, --j) {
+            const value_type z0{ list[j + d_1] };
+            const value_type z1{ list[j] ^ _M3_pos(list[j + d_3], 8) };
+            const value_type z2{ _M3_neg(list[j + d_24], 19) ^ _M3_neg(list[j + d_10], 14) };
+            const value_type z3{ z1 ^ z2 };
+
+            list[j] = z3;
+            list[j + d_1] = _M3_neg(z0, 11) ^ _M3_neg(z1, 7) ^ _M3_neg(z2, 13);
+            *out++ = z3;
+        }
+
+        remaining -= count;
+        const std::uint32_t last{ i - (count - 1) };
+        i = last == 0 ? STATE_SIZE - 1 : last - 1;
+    }
+
+    _internal_state.state.index = i;
+}
@@ -26,6 +26,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
 #include <cstdint>
 
 #include "utils/uint128.h"
@@ -138,8 +139,8 @@ const Well19937c::output_type Well19937c::next() noexcept
     }
 
     const value_type z0{ (_internal_state.state.list[i_1] & 0x0000'0001ul) ^ _internal_state.state.list[i_2] & 0xffff'fffeul };
-    const value_type z1{ _M3_neg(_internal_state.state.list[i], 25) ^ _M3_pos(_internal_state.state.list[(i + 70) % STATE_SIZE], 27) };
-    const value_type z2{ _M2_pos(_internal_state.state.list[(i + 179) % STATE_SIZE], 9) ^ _M3_pos(_internal_state.state.list[(i + 449) % STATE_SIZE], 1) };
+    const value_type z1{ _M3_neg(_internal_state.state.list[i], 25) ^ _M3_pos(_internal_state.state.list[i < STATE_SIZE - 70 ? i + 70 : i - (STATE_SIZE - 70)], 27) };
+    const value_type z2{ _M2_pos(_internal_state.state.list[i < STATE_SIZE - 179 ? i + 179 : i - (STATE_SIZE - 179)], 9) ^ _M3_pos(_internal_state.state.list[i < STATE_SIZE - 449 ? i + 449 : i - (STATE_SIZE - 449)], 1) };
     const value_type z3{ z1 ^ z2 };
 
     _internal_state.state.list[i] = z3;
@@ -151,3 +152,42 @@ const Well19937c::output_type Well19937c::next() noexcept
     return _tempering(z3, 0xe46e'1700ul, 0x9b86'8000ul);
 
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Well19937c::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over segments of decreasing indexes
+    // in which none of i-1, i-2, i+70, i+179 and i+449 wraps around STATE_SIZE
+    value_type* const list{ _internal_state.state.list.data() };
+    std::uint32_t i{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_low{ i >= 554 ? 554u : i >= 445 ? 445u : i >= 175 ? 175u : i >= 2 ? 2u : i };
+        const std::uint32_t d_1{ i >= 1 ? 0u - 1u : STATE_SIZE - 1 };  // notice: unsigned wrap-around makes j + d_1 == j - 1
+        const std::uint32_t d_2{ i >= 2 ? 0u - 2u : STATE_SIZE - 2 };
+        const std::uint32_t d_70{ i < STATE_SIZE - 70 ? 70u : 70u - STATE_SIZE };
+        const std::uint32_t d_179{ i < STATE_SIZE - 179 ? 179u : 179u - STATE_SIZE };
+        const std::uint32_t d_449{ i < STATE_SIZE - 449 ? 449u : 449u - STATE_SIZE };
+
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(i - segment_low + 1, remaining)) };
+        for (std::uint32_t k = 0, j = i; k < count; ++k, --j) {
+            const value_type z0{ (list[j + d_1] & 0x0000'0001ul) ^ list[j + d_2] & 0xffff'fffeul };
+            const value_type z1{ _M3_neg(list[j], 25) ^ _M3_pos(list[j + d_70], 27) };
+            const value_type z2{ _M2_pos(list[j + d_179], 9) ^ _M3_pos(list[j + d_449], 1) };
+            const value_type z3{ z1 ^ z2 };
+
+            list[j] = z3;
+            list[j + d_1] = z0 ^ _M3_neg(z1, 9) ^ _M2_neg(z2, 21) ^ _M3_pos(z3, 21);
+            *out++ = _tempering(z3, 0xe46e'1700ul, 0x9b86'8000ul);
+        }
+
+        remaining -= count;
+        const std::uint32_t last{ i - (count - 1) };
+        i = last == 0 ? STATE_SIZE - 1 : last - 1;
+    }
+
+    _internal_state.state.index = i;
+}
@@ -26,6 +26,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
 #include <cstdint>
 
 #include "utils/uint128.h"
@@ -138,8 +139,8 @@ const Well44497b::output_type Well44497b::next() noexcept
     }
 
     const value_type z0{ (_internal_state.state.list[i_1] & 0x0001'fffful) ^ _internal_state.state.list[i_2] & 0xfffe'0000ul };
-    const value_type z1{ _M3_neg(_internal_state.state.list[i], 24) ^ _M3_pos(_internal_state.state.list[(i + 23) % STATE_SIZE], 30) };
-    const value_type z2{ _M3_neg(_internal_state.state.list[(i + 481) % STATE_SIZE], 10) ^ _M2_neg(_internal_state.state.list[(i + 229) % STATE_SIZE], 26) };
+    const value_type z1{ _M3_neg(_internal_state.state.list[i], 24) ^ _M3_pos(_internal_state.state.list[i < STATE_SIZE - 23 ? i + 23 : i - (STATE_SIZE - 23)], 30) };
+    const value_type z2{ _M3_neg(_internal_state.state.list[i < STATE_SIZE - 481 ? i + 481 : i - (STATE_SIZE - 481)], 10) ^ _M2_neg(_internal_state.state.list[i < STATE_SIZE - 229 ? i + 229 : i - (STATE_SIZE - 229)], 26) };
     const value_type z3{ z1 ^ z2 };
 
     _internal_state.state.list[i] = z3;
@@ -151,3 +152,42 @@ const Well44497b::output_type Well44497b::next() noexcept
     return _tempering(z3, 0x93dd'1400ul, 0xfa11'8000ul);
 
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Well44497b::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over segments of decreasing indexes
+    // in which none of i-1, i-2, i+23, i+481 and i+229 wraps around STATE_SIZE
+    value_type* const list{ _internal_state.state.list.data() };
+    std::uint32_t i{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_low{ i >= 1368 ? 1368u : i >= 1162 ? 1162u : i >= 910 ? 910u : i >= 2 ? 2u : i };
+        const std::uint32_t d_1{ i >= 1 ? 0u - 1u : STATE_SIZE - 1 };  // notice: unsigned wrap-around makes j + d_1 == j - 1
+        const std::uint32_t d_2{ i >= 2 ? 0u - 2u : STATE_SIZE - 2 };
+        const std::uint32_t d_23{ i < STATE_SIZE - 23 ? 23u : 23u - STATE_SIZE };
+        const std::uint32_t d_481{ i < STATE_SIZE - 481 ? 481u : 481u - STATE_SIZE };
+        const std::uint32_t d_229{ i < STATE_SIZE - 229 ? 229u : 229u - STATE_SIZE };
+
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(i - segment_low + 1, remaining)) };
+        for (std::uint32_t k = 0, j = i; k < count; ++k, --j) {
+            const value_type z0{ (list[j + d_1] & 0x0001'fffful) ^ list[j + d_2] & 0xfffe'0000ul };
+            const value_type z1{ _M3_neg(list[j], 24) ^ _M3_pos(list[j + d_23], 30) };
+            const value_type z2{ _M3_neg(list[j + d_481], 10) ^ _M2_neg(list[j + d_229], 26) };
+            const value_type z3{ z1 ^ z2 };
+
+            list[j] = z3;
+            list[j + d_1] = z0 ^ _M3_pos(z1, 20) ^ _M6(z2, 9, 14, 5, _a7) ^ z3;
+            *out++ = _tempering(z3, 0x93dd'1400ul, 0xfa11'8000ul);
+        }
+
+        remaining -= count;
+        const std::uint32_t last{ i - (count - 1) };
+        i = last == 0 ? STATE_SIZE - 1 : last - 1;
+    }
+
+    _internal_state.state.index = i;
+}
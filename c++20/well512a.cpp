@@ -26,6 +26,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <algorithm>
 #include <cstdint>
 
 #include "well512a.h"
@@ -135,3 +136,40 @@ const Well512a::output_type Well512a::next() noexcept
 
     return z3;
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Well512a::fill(std::span<output_type> values) noexcept
+{
+    // notice: same algorithm as in next(), run over segments of decreasing indexes
+    // in which none of i-1, i+13 and i+9 wraps around STATE_SIZE
+    value_type* const list{ _internal_state.state.list.data() };
+    std::uint32_t i{ _internal_state.state.index };
+
+    output_type* out{ values.data() };
+    std::size_t remaining{ values.size() };
+    while (remaining > 0) {
+        const std::uint32_t segment_low{ i >= 7 ? 7u : i >= 3 ? 3u : i >= 1 ? 1u : 0u };
+        const std::uint32_t d_1{ i >= 1 ? 0u - 1u : STATE_SIZE - 1 };  // notice: unsigned wrap-around makes j + d_1 == j - 1
+        const std::uint32_t d_13{ i < STATE_SIZE - 13 ? 13u : 13u - STATE_SIZE };
+        const std::uint32_t d_9{ i < STATE_SIZE - 9 ? 9u : 9u - STATE_SIZE };
+
+        const std::uint32_t count{ std::uint32_t(std::min<std::size_t>(i - segment_low + 1, remaining)) };
+        for (std::uint32_t k = 0, j = i; k < count; ++k, --j) {
+            const value_type z0{ list[j + d_1] };
+            const value_type z1{ _M3_neg(list[j], 16) ^ _M3_neg(list[j + d_13], 15) };
+            const value_type z2{ _M3_pos(list[j + d_9], 11) };
+            const value_type z3{ z1 ^ z2 };
+
+            list[j] = z3;
+            list[j + d_1] = _M3_neg(z0, 2) ^ _M3_neg(z1, 18) ^ _M2_neg(z2, 28) ^ _M5_neg(z3, 5, _a1);
+            *out++ = z3;
+        }
+
+        remaining -= count;
+        const std::uint32_t last{ i - (count - 1) };
+        i = last == 0 ? STATE_SIZE - 1 : last - 1;
+    }
+
+    _internal_state.state.index = i;
+}
@@ -133,3 +133,11 @@ const Xoroshiro1024::output_type Xoroshiro1024::next() noexcept
     // finally, returns pseudo random value as a 64-bits integer
     return utils::rot_left(s_low * 5, 7) * 9;
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Xoroshiro1024::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Xoroshiro1024::next();
+}
@@ -33,9 +33,11 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <array>
 #include <cstdint>
 
 #include "baseclasses/basexoroshiro.h"
+#include "utils/bits_rotations.h"
 #include "utils/uint128.h"
 
 
@@ -96,11 +98,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Xoroshiro1024 : public BaseXoroshiro<16>
+class Xoroshiro1024 : public BaseXoroshiro<16, Xoroshiro1024>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseXoroshiro<16>;
+    using MyBaseClass = BaseXoroshiro<16, Xoroshiro1024>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -121,8 +123,47 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;         //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual const output_type next() noexcept override final;   //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
+
+
+    //---   Jumps   ---------------------------------------------------------
+    static constexpr std::array<value_type, 16> JUMP_POLYNOMIAL{
+        0x9311'97d8'e317'7f17ull, 0xb594'22e0'b913'8c5full, 0xf06a'6afb'49d6'68bbull, 0xacb8'a641'2c8a'1401ull,
+        0x1230'4ec8'5f0b'3468ull, 0xb7df'e707'9209'891eull, 0x405b'7eec'77d9'eb14ull, 0x34ea'd682'80c4'4e4aull,
+        0xe0e4'ba3e'0ac9'e366ull, 0x8f46'eda8'3489'05b7ull, 0x328b'f4db'ad90'd6ffull, 0xc8fd'6fb3'1c9e'ffc3ull,
+        0xe899'd452'd4b6'7652ull, 0x45f3'8728'6ade'3205ull, 0x0386'4f45'4a89'20bdull, 0xa68f'a287'25b1'b384ull
+    };  //!< The jump polynomial for 2^512 steps, see [10] in README.md.
+
+    static constexpr std::array<value_type, 16> LONG_JUMP_POLYNOMIAL{
+        0x7374'1563'60bb'f00full, 0x4630'c2ef'a3b3'c1f6ull, 0x6654'183a'8927'86b1ull, 0x94f7'bfcb'fb0f'1661ull,
+        0x27d8'243d'3d13'eb2dull, 0x9701'730f'3dfb'300full, 0x2f29'3baa'e6f6'04adull, 0xa661'831c'b60c'd8b6ull,
+        0x6828'0c77'd9fe'008cull, 0x5055'4160'f5ba'9459ull, 0x2fc2'0b17'ec7b'2a9aull, 0x4918'9bbd'c8ec'9f8full,
+        0x92a6'5bca'4185'2cc1ull, 0xf468'20dd'0509'c12aull, 0x52b0'0c35'fbf9'2185ull, 0x1e5b'3b7f'589e'03c1ull
+    };  //!< The jump polynomial for 2^768 steps, see [10] in README.md.
+
+    static constexpr bool _JUMP_USES_INDEX{ true };  //!< Tells jump() whether the index of the internal list is used by this engine.
+
+    static inline void _jump_step(std::array<value_type, 16>& s, std::uint32_t& index) noexcept;  //!< Advances the linear engine on a copy of the internal list, with no output.
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** Advances the linear engine on a copy of the internal list, with no output. */
+inline void Xoroshiro1024::_jump_step(std::array<value_type, 16>& s, std::uint32_t& index) noexcept
+{
+    const std::uint32_t new_index{ (index + 1) & 0xf };
+
+    const value_type s_low{ s[new_index] };
+    const value_type s_high{ s[index] ^ s_low };
+
+    s[index] = utils::rot_left(s_low, 25) ^ s_high ^ (s_high << 27);
+    s[new_index] = utils::rot_left(s_high, 36);
+
+    index = new_index;
+}
+
 /** @}*/
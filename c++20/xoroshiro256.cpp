@@ -131,3 +131,11 @@ const Xoroshiro256::output_type Xoroshiro256::next() noexcept
     // finally, returns pseudo random value as a 64-bits integer
     return utils::rot_left(current_s1 * 5, 7) * 9;
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Xoroshiro256::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Xoroshiro256::next();
+}
@@ -33,8 +33,10 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <array>
 #include <cstdint>
 
+#include "utils/bits_rotations.h"
 #include "utils/uint128.h"
 #include "baseclasses/basexoroshiro.h"
 
@@ -98,11 +100,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Xoroshiro256 : public BaseXoroshiro<4>
+class Xoroshiro256 : public BaseXoroshiro<4, Xoroshiro256>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseXoroshiro<4>;
+    using MyBaseClass = BaseXoroshiro<4, Xoroshiro256>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -123,8 +125,60 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;         //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual const output_type next() noexcept override final;   //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
+
+
+    //---   Jumps   ---------------------------------------------------------
+    static constexpr std::array<value_type, 4> JUMP_POLYNOMIAL{
+        0x180e'c6d3'3cfd'0abaull, 0xd5a6'1266'f0c9'392cull, 0xa958'2618'e03f'c9aaull, 0x39ab'dc45'29b1'661cull
+    };  //!< The jump polynomial for 2^128 steps, see [10] in README.md.
+
+    static constexpr std::array<value_type, 4> LONG_JUMP_POLYNOMIAL{
+        0x76e1'5d3e'fefd'cbbfull, 0xc500'4e44'1c52'2fb3ull, 0x7771'0069'854e'e241ull, 0x3910'9bb0'2acb'e635ull
+    };  //!< The jump polynomial for 2^192 steps, see [10] in README.md.
+
+    static constexpr bool _JUMP_USES_INDEX{ false };  //!< Tells jump() whether the index of the internal list is used by this engine.
+
+    static inline void _jump_step(std::array<value_type, 4>& s, std::uint32_t& index) noexcept;  //!< Advances the linear engine on a copy of the internal list, with no output.
+
+    template<const std::uint32_t LANES>
+    static inline const value_type _next_lane(std::array<std::array<value_type, LANES>, 4>& lanes, const std::uint32_t l) noexcept;  //!< The internal PRNG algorithm applied to lane l of a structure of arrays of states, see XoroshiroLanes.
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** Advances the linear engine on a copy of the internal list, with no output. */
+inline void Xoroshiro256::_jump_step(std::array<value_type, 4>& s, std::uint32_t& /*index*/) noexcept  // notice: index is not used with this engine
+{
+    const value_type s1{ s[1] };
+
+    s[2] ^= s[0];
+    s[3] ^= s1;
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= s1 << 17;
+    s[3] = utils::rot_left(s[3], 45);
+}
+
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm applied to lane l of a structure of arrays of states, see XoroshiroLanes. */
+template<const std::uint32_t LANES>
+inline const Xoroshiro256::value_type Xoroshiro256::_next_lane(std::array<std::array<value_type, LANES>, 4>& lanes, const std::uint32_t l) noexcept
+{
+    const value_type s1{ lanes[1][l] };
+
+    lanes[2][l] ^= lanes[0][l];
+    lanes[3][l] ^= s1;
+    lanes[1][l] ^= lanes[2][l];
+    lanes[0][l] ^= lanes[3][l];
+    lanes[2][l] ^= s1 << 17;
+    lanes[3][l] = utils::rot_left(lanes[3][l], 45);
+
+    return utils::rot_left(s1 * 5, 7) * 9;
+}
+
 /** @}*/
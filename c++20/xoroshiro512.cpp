@@ -135,3 +135,11 @@ const Xoroshiro512::output_type Xoroshiro512::next() noexcept
     // finally, returns pseudo random value as a 64-bits integer
     return utils::rot_left(current_s1 * 5, 7) * 9;
 }
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+void Xoroshiro512::fill(std::span<output_type> values) noexcept
+{
+    for (output_type& value : values)
+        value = Xoroshiro512::next();
+}
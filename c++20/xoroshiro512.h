@@ -33,8 +33,10 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <array>
 #include <cstdint>
 
+#include "utils/bits_rotations.h"
 #include "utils/uint128.h"
 #include "baseclasses/basexoroshiro.h"
 
@@ -96,11 +98,11 @@ SOFTWARE.
 *   * _big crush_ is the ultimate set of difficult tests that  any  GOOD  PRNG
 *   should definitively pass.
 */
-class Xoroshiro512 : public BaseXoroshiro<8>
+class Xoroshiro512 : public BaseXoroshiro<8, Xoroshiro512>
 {
 public:
     //---   Wrappers   ------------------------------------------------------
-    using MyBaseClass = BaseXoroshiro<8>;
+    using MyBaseClass = BaseXoroshiro<8, Xoroshiro512>;
 
 
     //---   Constructors / Destructor   -------------------------------------
@@ -121,8 +123,70 @@ public:
 
 
     //---   Operations   ----------------------------------------------------
-    virtual const output_type next() noexcept override;         //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual const output_type next() noexcept override final;   //!< The internal PRNG algorithm. @return an integer value coded on 32 bits.
+    virtual void fill(std::span<output_type> values) noexcept override final; //!< Fills a span with successive outputs of the internal PRNG.
+
+
+    //---   Jumps   ---------------------------------------------------------
+    static constexpr std::array<value_type, 8> JUMP_POLYNOMIAL{
+        0x33ed'89b6'e7a3'53f9ull, 0x7600'83d7'9553'23beull, 0x2837'f2fb'b5f2'2faeull, 0x4b8c'5674'd309'511cull,
+        0xb11a'c47a'7ba2'8c25ull, 0xf1be'7667'092b'cc1cull, 0x5385'1efd'b6df'0aafull, 0x1ebb'c8b2'3eaf'25dbull
+    };  //!< The jump polynomial for 2^256 steps, see [10] in README.md.
+
+    static constexpr std::array<value_type, 8> LONG_JUMP_POLYNOMIAL{
+        0x1146'7fef'8f92'1d28ull, 0xa2a8'19f2'e79c'8ea8ull, 0xa829'9fc2'84b3'959aull, 0xb4d3'4734'0ca6'3ee1ull,
+        0x1cb0'940b'edbf'f6ceull, 0xd956'c5c4'fa1f'8e17ull, 0x915e'38fd'4eda'93bcull, 0x5b3c'cdfa'5d7d'aca5ull
+    };  //!< The jump polynomial for 2^384 steps, see [10] in README.md.
+
+    static constexpr bool _JUMP_USES_INDEX{ false };  //!< Tells jump() whether the index of the internal list is used by this engine.
+
+    static inline void _jump_step(std::array<value_type, 8>& s, std::uint32_t& index) noexcept;  //!< Advances the linear engine on a copy of the internal list, with no output.
+
+    template<const std::uint32_t LANES>
+    static inline const value_type _next_lane(std::array<std::array<value_type, LANES>, 8>& lanes, const std::uint32_t l) noexcept;  //!< The internal PRNG algorithm applied to lane l of a structure of arrays of states, see XoroshiroLanes.
 
 };
 
+
+//===========================================================================
+//---   IMPLEMENTATION   ----------------------------------------------------
+//---------------------------------------------------------------------------
+/** Advances the linear engine on a copy of the internal list, with no output. */
+inline void Xoroshiro512::_jump_step(std::array<value_type, 8>& s, std::uint32_t& /*index*/) noexcept  // notice: index is not used with this engine
+{
+    const value_type s1{ s[1] };
+
+    s[2] ^= s[0];
+    s[5] ^= s1;
+    s[1] ^= s[2];
+    s[7] ^= s[3];
+    s[3] ^= s[4];
+    s[4] ^= s[5];
+    s[0] ^= s[6];
+    s[6] ^= s[7];
+    s[6] ^= s1 << 11;
+    s[7] = utils::rot_left(s[7], 21);
+}
+
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm applied to lane l of a structure of arrays of states, see XoroshiroLanes. */
+template<const std::uint32_t LANES>
+inline const Xoroshiro512::value_type Xoroshiro512::_next_lane(std::array<std::array<value_type, LANES>, 8>& lanes, const std::uint32_t l) noexcept
+{
+    const value_type s1{ lanes[1][l] };
+
+    lanes[2][l] ^= lanes[0][l];
+    lanes[5][l] ^= s1;
+    lanes[1][l] ^= lanes[2][l];
+    lanes[7][l] ^= lanes[3][l];
+    lanes[3][l] ^= lanes[4][l];
+    lanes[4][l] ^= lanes[5][l];
+    lanes[0][l] ^= lanes[6][l];
+    lanes[6][l] ^= lanes[7][l];
+    lanes[6][l] ^= s1 << 11;
+    lanes[7][l] = utils::rot_left(lanes[7][l], 21);
+
+    return utils::rot_left(s1 * 5, 7) * 9;
+}
+
 /** @}*/
@@ -0,0 +1,77 @@
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+//===========================================================================
+#include <cstdint>
+
+#include "utils/target_clones.h"
+#include "xoroshirolanes.h"
+
+
+//===========================================================================
+namespace
+{
+    //-----------------------------------------------------------------------
+    /** Evaluates steps successive steps of all lanes, LANES interleaved outputs per step.
+    *
+    * The inner loop applies the same operations to contiguous items of all
+    * lanes, and gets vectorized. The lanes are processed in a local copy, so
+    * that their states do not get reloaded after each store into out.
+    */
+    template<typename XoroshiroT, const std::uint32_t LANES, typename LanesT>
+    CPPRL_TARGET_CLONES
+    void fill_lanes(LanesT& lanes, std::uint64_t* out, std::size_t steps) noexcept
+    {
+        LanesT s{ lanes };
+
+        for (; steps > 0; --steps, out += LANES)
+            for (std::uint32_t l = 0; l < LANES; ++l)
+                out[l] = XoroshiroT::template _next_lane<LANES>(s, l);
+
+        lanes = s;
+    }
+}
+
+
+//===========================================================================
+//---------------------------------------------------------------------------
+/** Evaluates steps successive steps of all lanes, LANES interleaved outputs per step. */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+void XoroshiroLanes<XoroshiroT, LANES>::_fill_lanes(lanes_type& lanes, output_type* out, std::size_t steps) noexcept
+{
+    fill_lanes<XoroshiroT, LANES>(lanes, out, steps);
+}
+
+
+//===========================================================================
+template class XoroshiroLanes<Xoroshiro256, 4>;
+template class XoroshiroLanes<Xoroshiro256, 8>;
+template class XoroshiroLanes<Xoroshiro256, 16>;
+template class XoroshiroLanes<Xoroshiro512, 4>;
+template class XoroshiroLanes<Xoroshiro512, 8>;
+template class XoroshiroLanes<Xoroshiro512, 16>;
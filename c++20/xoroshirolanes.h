@@ -0,0 +1,325 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @addtogroup xoroshiro-algorithms
+ *
+ *  @{
+ */
+
+
+//===========================================================================
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "baseclasses/baserandom.h"
+#include "internalstates/lanesstate.h"
+#include "utils/uint128.h"
+#include "xoroshiro256.h"
+#include "xoroshiro512.h"
+
+
+//===========================================================================
+/** @brief Interleaved independent lanes of Xoroshiro256 or Xoroshiro512, for high throughput bulk generation.
+*
+*   This pseudorandom numbers generator runs LANES (4, 8 or 16) independent
+*   states  of  Xoroshiro256  or  Xoroshiro512,  which  are  stored  as  a
+*   structure of arrays.  Each step of the algorithm,  the  *5 rotl 7 *9
+*   scrambler included,  is then applied to all the lanes at once,  and gets
+*   evaluated with vector instructions (AVX2 or AVX-512 when available,  see
+*   utils/target_clones.h). This gets past the latency of the two scrambling
+*   multiplications that bounds the scalar versions of these PRNGs.
+*
+*   Lane 0 gets the same state as XoroshiroT when seeded with the same  seed
+*   and lane l+1 gets the state of lane l after a call to jump().  Lanes are
+*   then non-overlapping subsequences of the outputs of XoroshiroT (2^128 or
+*   2^256 steps apart).
+*
+*   Outputs are interleaved: each step of the lanes gets one output per lane,
+*   lane 0 first.  Method fill() writes them directly in the filled span  and
+*   method next() returns them one by one from an internal buffer,  which is
+*   refilled with a few steps at once (64 outputs).  Both get the same
+*   sequence of outputs.
+*
+*   Furthermore this class is callable:
+* @code
+*     Xoroshiro256x8 rand();
+*     std::cout << rand() << std::endl;    // prints a uniform pseudo-random value within [0.0, 1.0)
+*     std::cout << rand(b) << std::endl;   // prints a uniform pseudo-random value within [0.0, b)
+* @endcode
+*
+*   Notice that for simulating the roll of a dice you should program:
+* @code
+*     Xoroshiro512x8 diceRoll();
+*     std::cout << 1 + int(diceRoll(6)) << std::endl;   // prints a uniform roll within range {1, ..., 6}
+*     std::cout << diceRoll.randint(1, 6) << std::endl; // prints also a uniform roll within range {1, ..., 6}
+* @endcode
+*/
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+class XoroshiroLanes : public BaseRandom<LanesState<std::uint64_t, XoroshiroT::JUMP_POLYNOMIAL.size(), LANES>, std::uint64_t, 64, XoroshiroLanes<XoroshiroT, LANES>>
+{
+public:
+    //---   Wrappers   ------------------------------------------------------
+    using MyBaseClass = BaseRandom<LanesState<std::uint64_t, XoroshiroT::JUMP_POLYNOMIAL.size(), LANES>, std::uint64_t, 64, XoroshiroLanes<XoroshiroT, LANES>>;
+    using output_type = MyBaseClass::output_type;
+    using state_type = MyBaseClass::state_type;
+    using value_type = typename state_type::value_type;
+    using lanes_type = typename state_type::lanes_type;
+
+
+    //---   Constructors / Destructor   -------------------------------------
+    inline XoroshiroLanes() noexcept;                                   //!< Default empty constructor.
+
+    inline XoroshiroLanes(const int                seed) noexcept;      //!< Valued constructor (int).
+    inline XoroshiroLanes(const unsigned int       seed) noexcept;      //!< Valued constructor (unsigned int).
+    inline XoroshiroLanes(const long               seed) noexcept;      //!< Valued constructor (long)
+    inline XoroshiroLanes(const unsigned long      seed) noexcept;      //!< Valued constructor (unsigned long).
+    inline XoroshiroLanes(const long long          seed) noexcept;      //!< Valued constructor (long long).
+    inline XoroshiroLanes(const unsigned long long seed) noexcept;      //!< Valued constructor (unsigned long long).
+    inline XoroshiroLanes(const utils::UInt128&    seed) noexcept;      //!< Valued constructor (unsigned 128-bits).
+    inline XoroshiroLanes(const double             seed);               //!< Valued constructor (double).
+
+    inline XoroshiroLanes(const state_type& internal_state) noexcept;   //!< Valued constructor (full state).
+
+    virtual inline ~XoroshiroLanes() noexcept = default;                //!< default destructor.
+
+
+    //---   Operations   ----------------------------------------------------
+    virtual inline const output_type next() noexcept override final;    //!< The internal PRNG algorithm. @return an integer value coded on 64 bits.
+    virtual inline void fill(std::span<output_type> values) noexcept override final;  //!< Fills a span with successive outputs of the internal PRNG.
+
+    virtual inline void _setstate(const std::uint64_t   seed) noexcept override;  //!< Sets the internal state of this PRNG with a 64-bits integer seed.
+    virtual inline void _setstate(const utils::UInt128& seed) noexcept override;  //!< Sets the internal state of this PRNG with a 128-bits integer seed.
+
+
+private:
+    static void _fill_lanes(lanes_type& lanes, output_type* out, std::size_t steps) noexcept;  //!< Evaluates steps successive steps of all lanes, LANES interleaved outputs per step.
+
+};
+
+
+//===========================================================================
+using Xoroshiro256x4 = XoroshiroLanes<Xoroshiro256, 4>;     //!< 4 interleaved lanes of Xoroshiro256.
+using Xoroshiro256x8 = XoroshiroLanes<Xoroshiro256, 8>;     //!< 8 interleaved lanes of Xoroshiro256.
+using Xoroshiro256x16 = XoroshiroLanes<Xoroshiro256, 16>;   //!< 16 interleaved lanes of Xoroshiro256.
+
+using Xoroshiro512x4 = XoroshiroLanes<Xoroshiro512, 4>;     //!< 4 interleaved lanes of Xoroshiro512.
+using Xoroshiro512x8 = XoroshiroLanes<Xoroshiro512, 8>;     //!< 8 interleaved lanes of Xoroshiro512.
+using Xoroshiro512x16 = XoroshiroLanes<Xoroshiro512, 16>;   //!< 16 interleaved lanes of Xoroshiro512.
+
+// notice: method _fill_lanes() is compiled once per instructions set, in file xoroshirolanes.cpp
+extern template class XoroshiroLanes<Xoroshiro256, 4>;
+extern template class XoroshiroLanes<Xoroshiro256, 8>;
+extern template class XoroshiroLanes<Xoroshiro256, 16>;
+extern template class XoroshiroLanes<Xoroshiro512, 4>;
+extern template class XoroshiroLanes<Xoroshiro512, 8>;
+extern template class XoroshiroLanes<Xoroshiro512, 16>;
+
+
+//===========================================================================
+//---   TEMPLATES IMPLEMENTATION   ------------------------------------------
+//---------------------------------------------------------------------------
+/** Empty constructor. */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes() noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed();
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (int). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const int seed_) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed((unsigned long long)(seed_));
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (unsigned int). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const unsigned int seed_) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed((unsigned long long)(seed_));
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (long). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const long seed_) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed((unsigned long long)(seed_));
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (unsigned long). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const unsigned long seed_) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed((unsigned long long)(seed_));
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (long long). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const long long seed_) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed((unsigned long long)(seed_));
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (unsigned long long). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const unsigned long long seed_) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed((unsigned long long)(seed_));
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (unsigned 128-bits). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const utils::UInt128& seed_) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::seed(seed_);
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (double). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const double seed_)
+    : MyBaseClass()
+{
+    MyBaseClass::seed(seed_);
+}
+
+//---------------------------------------------------------------------------
+/** Valued constructor (full state). */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline XoroshiroLanes<XoroshiroT, LANES>::XoroshiroLanes(const state_type& internal_state) noexcept
+    : MyBaseClass()
+{
+    MyBaseClass::setstate(internal_state);
+}
+
+//---------------------------------------------------------------------------
+/** The internal PRNG algorithm. */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline const typename XoroshiroLanes<XoroshiroT, LANES>::output_type XoroshiroLanes<XoroshiroT, LANES>::next() noexcept
+{
+    state_type& state{ MyBaseClass::_internal_state.state };
+
+    if (state.index == state_type::BUFFER_SIZE) {
+        // the buffer is empty: all lanes are advanced by a few steps
+        _fill_lanes(state.lanes, state.buffer.data(), state_type::BUFFERED_STEPS);
+        state.index = 0;
+    }
+
+    return state.buffer[state.index++];
+}
+
+//---------------------------------------------------------------------------
+/** Fills a span with successive outputs of the internal PRNG. */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline void XoroshiroLanes<XoroshiroT, LANES>::fill(std::span<output_type> values) noexcept
+{
+    state_type& state{ MyBaseClass::_internal_state.state };
+    output_type* out{ values.data() };
+    std::size_t count{ values.size() };
+
+    // first, returns the outputs that remain in the buffer
+    for (; count > 0 && state.index < state_type::BUFFER_SIZE; --count)
+        *out++ = state.buffer[state.index++];
+
+    // then, whole steps of the lanes are directly written in the span
+    const std::size_t steps{ count / LANES };
+    if (steps > 0) {
+        _fill_lanes(state.lanes, out, steps);
+        out += steps * LANES;
+        count -= steps * LANES;
+    }
+
+    // finally, the last outputs come from a new content of the buffer
+    for (; count > 0; --count)
+        *out++ = next();
+}
+
+//---------------------------------------------------------------------------
+/** Sets the internal state of this PRNG with a 64-bits integer seed.
+*
+* Lane 0 gets the state of XoroshiroT seeded with the same seed, and lane
+* l+1 gets the state of lane l after a call to jump().
+*/
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline void XoroshiroLanes<XoroshiroT, LANES>::_setstate(const std::uint64_t seed_) noexcept
+{
+    state_type& state{ MyBaseClass::_internal_state.state };
+    XoroshiroT lane_rand((unsigned long long)seed_);  // notice: std::uint64_t is unsigned long on LP64 platforms, not unsigned long long
+
+    for (std::uint32_t l = 0; l < LANES; ++l) {
+        const auto& list{ lane_rand._internal_state.state.list };
+        for (std::size_t j = 0; j < list.size(); ++j)
+            state.lanes[j][l] = list[j];
+        lane_rand.jump();
+    }
+
+    state.buffer.fill(0);
+    state.index = state_type::BUFFER_SIZE;
+}
+
+//---------------------------------------------------------------------------
+/** Sets the internal state of this PRNG with a 128-bits integer seed. */
+template<typename XoroshiroT, const std::uint32_t LANES>
+    requires (std::is_same_v<XoroshiroT, Xoroshiro256> || std::is_same_v<XoroshiroT, Xoroshiro512>) && (LANES == 4 || LANES == 8 || LANES == 16)
+inline void XoroshiroLanes<XoroshiroT, LANES>::_setstate(const utils::UInt128& seed_) noexcept
+{
+    _setstate(seed_.lo);
+}
+
+/** @}*/
@@ -0,0 +1,66 @@
+#pragma once
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is provided with library CppRandLib.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+//===========================================================================
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+
+//===========================================================================
+/** @brief Tests that method fill() of a PRNG gets the same outputs as successive calls to its method next().
+*
+* Two PRNGs are seeded the same way.  The first one fills successively a
+* span of each of the specified sizes, then an empty span,  while the second
+* one only calls next(). With PRNGs that have an internal list, both internal
+* states are finally checked to be the same,  i.e. with the same index in
+* their list.
+*/
+template<typename PRNG>
+void tests_fill_against_next(const std::vector<std::size_t>& sizes = { 1, 2, 3, 5, 8, 13, 97, 2053 })  // notice: 2053 is a prime number
+{
+    PRNG rand_fill(1);
+    PRNG rand_next(1);
+
+    for (const std::size_t n : sizes) {
+        std::vector<typename PRNG::output_type> values(n);
+        rand_fill.fill(values);
+        for (const auto& v : values)
+            EXPECT_EQ(rand_next.next(), v);
+    }
+    EXPECT_EQ(rand_next.next(), rand_fill.next());
+
+    rand_fill.fill(std::span<typename PRNG::output_type>());
+    EXPECT_EQ(rand_next.next(), rand_fill.next());
+
+    if constexpr (requires (PRNG & p) { p._internal_state.state.list; p._internal_state.state.index; }) {
+        EXPECT_EQ(rand_next._internal_state.state, rand_fill._internal_state.state);
+    }
+}
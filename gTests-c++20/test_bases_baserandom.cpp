@@ -31,13 +31,16 @@ SOFTWARE.
 #include <cstdint>
 #include <list>
 #include <map>
+#include <span>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include "baseclasses/baserandom.h"
 #include "exceptions.h"
+#include "utils/discrete_sampler.h"
 #include "utils/uint128.h"
+#include "utils/ziggurat.h"
 
 
 //===========================================================================
@@ -291,6 +294,23 @@ namespace tests_bases
         EXPECT_EQ(0x5555'5555UL, br33.next());
 
 
+        //-- tests fill()
+        {
+            std::array<std::uint32_t, 17> values;
+            br0.fill(values);
+            for (const std::uint32_t v : values)
+                EXPECT_EQ(0UL, v);
+            br1.fill(values);
+            for (const std::uint32_t v : values)
+                EXPECT_EQ(0xffff'ffffUL, v);
+            br33.fill(values);
+            for (const std::uint32_t v : values)
+                EXPECT_EQ(0x5555'5555UL, v);
+            br33.fill(std::span<std::uint32_t>(values.data(), 3));
+            EXPECT_EQ(0x5555'5555UL, values[2]);
+        }
+
+
         //-- tests random()
         EXPECT_FLOAT_EQ(0.0f, br0.random<float>());
         EXPECT_DOUBLE_EQ(0.0, br0.random<double>());
@@ -307,6 +327,13 @@ namespace tests_bases
         EXPECT_NEAR(1.0 / 3.0, br33.random(), 1.0e-9);
         EXPECT_NEAR(1.0L / 3.0L, br33.random<long double>(), 1.0e-9L);
 
+        // notice: float values are built from the 24 most significant bits of outputs, and never round up to 1.0
+        EXPECT_EQ(float(0xff'ffff) / 16'777'216.0f, br1.random<float>());
+        EXPECT_LT(br1.random<float>(), 1.0f);
+        EXPECT_EQ(double(0xffff'ffff) / 4'294'967'296.0, br1.random<double>());
+        EXPECT_EQ(float(0x55'5555) / 16'777'216.0f, br33.random<float>());
+        EXPECT_EQ(double(0x5555'5555) / 4'294'967'296.0, br33.random<double>());
+
 
         //-- tests operator()
         EXPECT_FLOAT_EQ(0.0f, br0.operator() < float > ());
@@ -448,14 +475,28 @@ namespace tests_bases
 
 
         //-- tests binomialvariate()
-        EXPECT_EQ(15UL, br0.binomialvariate(15UL, 0.5));
-        EXPECT_EQ(0UL, br1.binomialvariate(15UL, 0.99));
-        EXPECT_EQ(15UL, br33.binomialvariate(15UL, 0.3334f));
+        // notice: inversion, i.e. sequential search over the cumulative distribution function, when n * p < 10
+        EXPECT_EQ(0UL, br0.binomialvariate(15UL, 0.5));
+        EXPECT_EQ(9UL, br1.binomialvariate(15UL, 0.99));  // notice: i.e. 15 - binomialvariate(15, 0.01)
+        EXPECT_EQ(4UL, br33.binomialvariate(15UL, 0.3334f));
 
         EXPECT_EQ(0, br0.binomialvariate(0, 0.5));
         EXPECT_EQ(0, br1.binomialvariate(0, 0.99));
         EXPECT_EQ(0, br33.binomialvariate(0, 0.3334f));
 
+        EXPECT_EQ(1, br0.binomialvariate(1, 0.5));
+        EXPECT_EQ(0, br1.binomialvariate(1, 0.99));
+        EXPECT_EQ(1, br33.binomialvariate(1, 0.3334f));
+        EXPECT_EQ(0, br33.binomialvariate(1, 0.3333f));
+
+        EXPECT_EQ(0LL, br1.binomialvariate(1'000'000'000LL, 0.0));
+        EXPECT_EQ(1'000'000'000LL, br1.binomialvariate(1'000'000'000LL, 1.0));
+
+        // notice: BTRS, i.e. transformed rejection with squeeze, when n * p >= 10
+        EXPECT_EQ(293, br33.binomialvariate(1'000, 0.3));
+        EXPECT_EQ(293, br33.binomialvariate(1'000, 0.3));  // notice: cached setup
+        EXPECT_EQ(1'000 - 293, br33.binomialvariate(1'000, 0.7));
+
         EXPECT_THROW(br0.binomialvariate(-1, 0.1f), PositiveValueException);
         EXPECT_THROW(br1.binomialvariate(-1, 0.1), PositiveValueException);
         EXPECT_THROW(br33.binomialvariate(-1, 0.1L), PositiveValueException);
@@ -474,6 +515,10 @@ namespace tests_bases
         EXPECT_EQ(br1.choice(max_vect), max_vect.back());
         EXPECT_EQ(br33.choice(max_vect), max_vect[max_vect.size() / 3]);
 
+        std::vector<char> char_vect(300, 'a');  // notice: more elements than values of type char
+        char_vect.back() = 'z';
+        EXPECT_EQ(br1.choice(char_vect), 'z');
+
         EXPECT_THROW(br0.choice(std::vector<std::uint32_t>()), ChoiceEmptySequenceException);
         EXPECT_THROW(br1.choice(std::vector<std::uint32_t>()), ChoiceEmptySequenceException);
         EXPECT_THROW(br33.choice(std::vector<std::uint32_t>()), ChoiceEmptySequenceException);
@@ -536,8 +581,9 @@ namespace tests_bases
             EXPECT_EQ('E', v);
 
         v_population = { 'A', 'B', 'C', 'D', 'E', 'F'};
-        std::vector<double> d_weights{ 0.10, 0.10, 0.10, 0.15, 0.30, 0.25 };
-        std::vector<int> i_weights{ 2, 2, 2, 3, 6, 5 };
+        const std::vector<double> d_weights{ 0.10, 0.10, 0.10, 0.15, 0.30, 0.25 };
+        const std::vector<int> i_weights{ 2, 2, 2, 3, 6, 5 };
+        // notice: alias table is [(.6, E), (.6, F), (.6, F), (.9, F), (1., E), (.6, E)] for both weights, columns and comparisons get drawn separately
         v_res = br0.choices(v_population, d_weights, 28);
         for (char v : v_res)
             EXPECT_EQ('A', v);
@@ -545,44 +591,59 @@ namespace tests_bases
         for (char v : v_res)
             EXPECT_EQ('A', v);
 
-        d_weights = { 0.10, 0.10, 0.10, 0.15, 0.30, 0.25 };
-        i_weights = { 2, 2, 2, 3, 6, 5 };
         v_res = br1.choices(v_population, d_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('F', v);
+            EXPECT_EQ('E', v);
         v_res = br1.choices(v_population, i_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('F', v);
+            EXPECT_EQ('E', v);
 
-        d_weights = { 0.10, 0.10, 0.10, 0.15, 0.30, 0.25 };
-        i_weights = { 2, 2, 2, 3, 6, 5 };
         v_res = br33.choices(v_population, d_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('D', v);
+            EXPECT_EQ('B', v);
         v_res = br33.choices(v_population, i_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('D', v);
+            EXPECT_EQ('B', v);
+
+        EXPECT_EQ(std::vector<int>({ 2, 2, 2, 3, 6, 5 }), i_weights);  // weights are not modified
 
-        d_weights = { 0.10, 0.20, 0.30, 0.45, 0.75, 1.00 };
-        i_weights = { 2, 4, 6, 9, 15, 20 };
-        v_res = br0.choices_cum(v_population, d_weights, 28);
+        const utils::DiscreteSampler sampler(i_weights);
+        v_res = br0.choices(v_population, sampler, 28);
         for (char v : v_res)
             EXPECT_EQ('A', v);
-        v_res = br0.choices_cum(v_population, i_weights, 28);
+        v_res = br1.choices(v_population, sampler, 28);
+        for (char v : v_res)
+            EXPECT_EQ('E', v);
+        v_res = br33.choices(v_population, sampler, 28);
+        for (char v : v_res)
+            EXPECT_EQ('B', v);
+
+        EXPECT_THROW(br0.choices(v_population, std::vector<int>{ 1, 2, 3 }, 28), SampleSizesException);
+        EXPECT_THROW(br0.choices(v_population, utils::DiscreteSampler(std::vector<int>{ 1, 2, 3 }), 28), SampleSizesException);
+        EXPECT_THROW(br0.choices(std::vector<char>(), sampler, 28), ZeroLengthException);
+
+        const std::vector<double> d_cum_weights{ 0.10, 0.20, 0.30, 0.45, 0.75, 1.00 };
+        const std::vector<int> i_cum_weights{ 2, 4, 6, 9, 15, 20 };
+        v_res = br0.choices_cum(v_population, d_cum_weights, 28);
         for (char v : v_res)
             EXPECT_EQ('A', v);
-        v_res = br1.choices_cum(v_population, d_weights, 28);
+        v_res = br0.choices_cum(v_population, i_cum_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('F', v);
-        v_res = br1.choices_cum(v_population, i_weights, 28);
+            EXPECT_EQ('A', v);
+        v_res = br1.choices_cum(v_population, d_cum_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('F', v);
-        v_res = br33.choices_cum(v_population, d_weights, 28);
+            EXPECT_EQ('E', v);
+        v_res = br1.choices_cum(v_population, i_cum_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('D', v);
-        v_res = br33.choices_cum(v_population, i_weights, 28);
+            EXPECT_EQ('E', v);
+        v_res = br33.choices_cum(v_population, d_cum_weights, 28);
         for (char v : v_res)
-            EXPECT_EQ('D', v);
+            EXPECT_EQ('B', v);
+        v_res = br33.choices_cum(v_population, i_cum_weights, 28);
+        for (char v : v_res)
+            EXPECT_EQ('B', v);
+
+        EXPECT_THROW(br0.choices_cum(v_population, std::vector<int>{ 2, 4, 6, 5, 15, 20 }, 28), NegativeWeightException);
 
 
         //-- tests getrandbits()
@@ -808,11 +869,11 @@ namespace tests_bases
         //-- tests randint()
         EXPECT_EQ(1, br0.randint(1, 5));
         EXPECT_EQ(10ULL, br1.randint(0ULL, 10ULL));
-        EXPECT_EQ(std::int8_t(double(7 * .3333333 - 7)), br33.randint(std::int8_t(-7), std::int8_t(-1)));
+        EXPECT_EQ(std::int8_t(int(7 * .3333333) - 7), br33.randint(std::int8_t(-7), std::int8_t(-1)));
 
         EXPECT_EQ(1, br0.randint(5, 1));
         EXPECT_EQ(10ULL, br1.randint(10ULL, 0ULL));
-        EXPECT_EQ(std::int8_t(double(7 * .3333333 - 7)), br33.randint(std::int8_t(-1), std::int8_t(-7)));
+        EXPECT_EQ(std::int8_t(int(7 * .3333333) - 7), br33.randint(std::int8_t(-1), std::int8_t(-7)));
 
 
         //-- tests randrange()
@@ -886,7 +947,27 @@ namespace tests_bases
         for (int i = 0; i < k; ++i)
             EXPECT_EQ("EAFGDHIBJKCLM"[i], vect_c[i]);
 
+        // notice: elements larger than indexes are gathered from the shuffled indexes, with same selection
+        std::vector<std::array<char, 32>> vect_large_population(N_vect_population);
+        for (std::size_t i = 0; i < N_vect_population; ++i)
+            vect_large_population[i].fill(vect_population[i]);
+        std::vector<std::array<char, 32>> vect_large;
+        k = 5;
+        br33.sample(vect_large, vect_large_population, k);
+        for (int i = 0; i < k; ++i)
+            EXPECT_EQ("EAFGD"[i], vect_large[i].back());
+
+        // notice: std::vector<bool> gets the same selection also
+        std::vector<bool> vect_bool_population(N_vect_population);
+        for (std::size_t i = 0; i < N_vect_population; ++i)
+            vect_bool_population[i] = (i % 2 == 0);
+        std::vector<bool> vect_bool;
+        k = 5;
+        br33.sample(vect_bool, vect_bool_population, k);
+        EXPECT_EQ(std::vector<bool>({ true, true, false, true, false }), vect_bool);
+
         EXPECT_THROW(br0.sample(vect_c, vect_population, N_vect_population + 1), SampleCountException);
+        EXPECT_THROW(br0.sample(vect_bool, vect_bool_population, N_vect_population + 1), SampleCountException);
 
 
         //-- tests samples(array, k)
@@ -920,6 +1001,37 @@ namespace tests_bases
         EXPECT_THROW(br0.sample(arr_c14, arr_population), SampleCountException);
 
 
+        //-- tests sample_indexes(vector, n, k)
+        std::vector<std::size_t> indexes;
+
+        br0.sample_indexes(indexes, 13, 0);
+        EXPECT_EQ(0ULL, indexes.size());
+        br0.sample_indexes(indexes, 13, 5);  // notice: dense shuffling
+        EXPECT_EQ(std::vector<std::size_t>({ 0, 1, 2, 3, 4 }), indexes);
+        br0.sample_indexes(indexes, 1'000, 5);  // notice: sparse shuffling
+        EXPECT_EQ(std::vector<std::size_t>({ 0, 1, 2, 3, 4 }), indexes);
+
+        br1.sample_indexes(indexes, 13, 5);
+        EXPECT_EQ(std::vector<std::size_t>({ 12, 0, 1, 2, 3 }), indexes);
+        br1.sample_indexes(indexes, 1'000, 5);
+        EXPECT_EQ(std::vector<std::size_t>({ 999, 0, 1, 2, 3 }), indexes);
+
+        br33.sample_indexes(indexes, 13, 5);
+        EXPECT_EQ(std::vector<std::size_t>({ 4, 0, 5, 6, 3 }), indexes);
+        br33.sample_indexes(indexes, 1'000, 5);
+        EXPECT_EQ(std::vector<std::size_t>({ 333, 0, 334, 335, 3 }), indexes);
+
+        br33.sample_indexes(indexes, 50'000'000, 100);
+        EXPECT_EQ(100ULL, indexes.size());
+        for (std::size_t i = 0; i < indexes.size(); ++i) {
+            EXPECT_LT(indexes[i], 50'000'000ULL);
+            for (std::size_t j = i + 1; j < indexes.size(); ++j)
+                EXPECT_NE(indexes[i], indexes[j]);
+        }
+
+        EXPECT_THROW(br0.sample_indexes(indexes, 13, 14), SampleCountException);
+
+
         //-- tests samples(vector, vector, vector, k)
 
         // first, with all counts set to 1
@@ -945,24 +1057,24 @@ namespace tests_bases
         k = 5;
         br1.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("MABCD"[i], vect_c[i]);
+            EXPECT_EQ("MLKJI"[i], vect_c[i]);
         k = int(N_vect_population);
         br1.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("MABCDEFGHIJKL"[i], vect_c[i]);
+            EXPECT_EQ("MLKJIHGFEDCBA"[i], vect_c[i]);
 
         k = 0;
         br33.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("EAFGDHIBJKCLM"[i], vect_c[i]);
+            EXPECT_EQ("EDFGCHIBJKALM"[i], vect_c[i]);
         k = 5;
         br33.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("EAFGD"[i], vect_c[i]);
+            EXPECT_EQ("EDFGC"[i], vect_c[i]);
         k = int(N_vect_population);
         br33.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("EAFGDHIBJKCLM"[i], vect_c[i]);
+            EXPECT_EQ("EDFGCHIBJKALM"[i], vect_c[i]);
 
 
         // then, with some counts different from 1
@@ -990,11 +1102,11 @@ namespace tests_bases
         k = 5;
         br1.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("LBBCD"[i], vect_c[i]);
+            EXPECT_EQ("LLKKJ"[i], vect_c[i]);
         k = N_COUNTS;
         br1.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("LBBCDDDEFFHHIJJJKKL"[i], vect_c[i]);
+            EXPECT_EQ("LLKKJJJIHHFFEDDDCBB"[i], vect_c[i]);
 
         k = 0;
         br33.sample(vect_c, vect_population, vect_counts, k);
@@ -1003,11 +1115,17 @@ namespace tests_bases
         k = 5;
         br33.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("EBFFD"[i], vect_c[i]);
+            EXPECT_EQ("EDFFD"[i], vect_c[i]);
         k = N_COUNTS;
         br33.sample(vect_c, vect_population, vect_counts, k);
         for (int i = 0; i < k; ++i)
-            EXPECT_EQ("EBFFDHHBIJDJJCKKDLL"[i], vect_c[i]);
+            EXPECT_EQ("EDFFDHHDIJCJJBKKBLL"[i], vect_c[i]);
+
+        // notice: std::vector<bool> gets the same selection also
+        k = 5;
+        br33.sample(vect_bool, vect_bool_population, vect_counts, k);
+        EXPECT_EQ(std::vector<bool>({ true, false, false, false, false }), vect_bool);
+        EXPECT_THROW(br33.sample(vect_bool, vect_bool_population, vect_counts, N_COUNTS + 1), SampleCountException);
 
 
         // what about all counts set to 0?
@@ -1050,6 +1168,9 @@ namespace tests_bases
         EXPECT_THROW(br1.sample(vect_c, vect_population, vect_counts, N_COUNTS + 5), SampleCountException);
         EXPECT_THROW(br33.sample(vect_c, vect_population, vect_counts, std::uint32_t(0xffff'ffff'ffff'ffffULL)), SampleCountException);
 
+        vect_counts = { 0, 2, 1, 3, 1, 2, 0, -2, 1, 3, 2, 2, 0 };
+        EXPECT_THROW(br0.sample(vect_c, vect_population, vect_counts, 5), PositiveValueException);
+
 
         //-- tests samples(array, array, k)
 
@@ -1069,18 +1190,18 @@ namespace tests_bases
 
         br1.sample(arr_c5, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c5.size(); ++i)
-            EXPECT_EQ("MABCD"[i], arr_c5[i]);
+            EXPECT_EQ("MLKJI"[i], arr_c5[i]);
         br1.sample(arr_c13, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c13.size(); ++i)
-            EXPECT_EQ("MABCDEFGHIJKL"[i], arr_c13[i]);
+            EXPECT_EQ("MLKJIHGFEDCBA"[i], arr_c13[i]);
         EXPECT_THROW(br1.sample(arr_c19, arr_population, arr_counts), SampleCountException);
 
         br33.sample(arr_c5, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c5.size(); ++i)
-            EXPECT_EQ("EAFGDHIBJKCLM"[i], arr_c5[i]);
+            EXPECT_EQ("EDFGCHIBJKALM"[i], arr_c5[i]);
         br33.sample(arr_c13, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c13.size(); ++i)
-            EXPECT_EQ("EAFGDHIBJKCLM"[i], arr_c13[i]);
+            EXPECT_EQ("EDFGCHIBJKALM"[i], arr_c13[i]);
         EXPECT_THROW(br33.sample(arr_c19, arr_population, arr_counts), SampleCountException);
 
 
@@ -1098,18 +1219,18 @@ namespace tests_bases
 
         br1.sample(arr_c5, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c5.size(); ++i)
-            EXPECT_EQ("LBBCDDDEFFHHIJJJKKL"[i], arr_c5[i]);
+            EXPECT_EQ("LLKKJJJIHHFFEDDDCBB"[i], arr_c5[i]);
         br1.sample(arr_c13, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c13.size(); ++i)
-            EXPECT_EQ("LBBCDDDEFFHHIJJJKKL"[i], arr_c13[i]);
+            EXPECT_EQ("LLKKJJJIHHFFEDDDCBB"[i], arr_c13[i]);
         EXPECT_THROW(br1.sample(arr_c20, arr_population, arr_counts), SampleCountException);
 
         br33.sample(arr_c5, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c5.size(); ++i)
-            EXPECT_EQ("EBFFDHHBIJDJJCKKDLL"[i], arr_c5[i]);
+            EXPECT_EQ("EDFFDHHDIJCJJBKKBLL"[i], arr_c5[i]);
         br33.sample(arr_c13, arr_population, arr_counts);
         for (std::size_t i = 0; i < arr_c13.size(); ++i)
-            EXPECT_EQ("EBFFDHHBIJDJJCKKDLL"[i], arr_c13[i]);
+            EXPECT_EQ("EDFFDHHDIJCJJBKKBLL"[i], arr_c13[i]);
         EXPECT_THROW(br33.sample(arr_c20, arr_population, arr_counts), SampleCountException);
 
 
@@ -1240,39 +1361,36 @@ namespace tests_bases
 
 
         //-- tests betavariate()
-        // Notice: hard coded values here all come from same calls in PyRandLib. See README.md
-        // br0
-        for (double alpha : {0.13, 0.23, 1.00, 1.13, 2.23})
-            for (double beta : {0.13, 0.23, 1.00, 1.13, 2.23})
-                EXPECT_DOUBLE_EQ(0.0, br0.gammavariate(alpha, beta));
+        // notice: ziggurat method for exponential values, 64 random bits as 8 bits layer index, 53 bits abscissa and 3 unused bits
+        const double expo1{ double(0x1f'ffff'ffff'ffffULL) * utils::ziggurat::EXPO_W[0xff] };  // notice: always rejected, falls back on last evaluated value
+        const double expo33{ double(0xa'aaaa'aaaa'aaaaULL) * utils::ziggurat::EXPO_W[0x55] };
+
+        // notice: Marsaglia and Tsang's method for gamma values, z being a ziggurat normal value and u a uniform value
+        auto mt_gamma = [](const double alpha, const double z) {
+            const double d{ alpha - 1.0 / 3.0 };
+            const double c{ 1.0 / std::sqrt(9.0 * d) };
+            double v{ 1.0 + c * z };
+            v = v * v * v;
+            return d * v;
+        };
+        const double z33{ double(0xa'aaaa'aaaa'aaaaULL) * utils::ziggurat::NORMAL_W[0x55] };
+        const double u33{ double(0x5555'5555ULL) / double(1ULL << 32) };
+
+        // notice: gamma values with beta = 1.0 - br1 always rejects the values of Marsaglia and Tsang's method, so it gets tested with alpha = 1.0 only
+        auto gamma0 = [&](const double alpha) { return (alpha == 1.0) ? 0.0 : (alpha < 1.0) ? mt_gamma(alpha + 1.0, 0.0) : mt_gamma(alpha, 0.0); };
+        auto gamma33 = [&](const double alpha) { return (alpha == 1.0) ? expo33 : (alpha < 1.0) ? mt_gamma(alpha + 1.0, z33) * std::pow(1.0 - u33, 1.0 / alpha) : mt_gamma(alpha, z33); };
+
+        for (double alpha : {0.13, 0.20, 0.23, 1.00, 1.13, 2.23}) {
+            for (double beta : {0.13, 0.20, 0.23, 1.00, 1.13, 2.23}) {
+                const double g0{ gamma0(alpha) };
+                EXPECT_DOUBLE_EQ((g0 == 0.0) ? 0.0 : g0 / (g0 + gamma0(beta)), br0.betavariate(alpha, beta));
+                EXPECT_DOUBLE_EQ(gamma33(alpha) / (gamma33(alpha) + gamma33(beta)), br33.betavariate(alpha, beta));
+            }
+        }
 
-        // br1
-        EXPECT_NEAR(0.16711240545381284, br1.betavariate(1.00, 0.20), 1.0e-6);
         EXPECT_DOUBLE_EQ(0.5, br1.betavariate(1.00, 1.00));
-        EXPECT_NEAR(0.0038129414259181348, br1.betavariate(1.00, 2.23), 1.0e-6);
-        EXPECT_DOUBLE_EQ(0.63924876589595836, br1.betavariate(0.13, 0.23));
-        EXPECT_DOUBLE_EQ(0.36075123410404181, br1.betavariate(0.23, 0.13));
-        EXPECT_DOUBLE_EQ(0.5, br1.betavariate(0.23, 0.23));
-        EXPECT_NEAR(0.8328875945461871, br1.betavariate(0.20, 1.00), 1.0e-6);
-        EXPECT_NEAR(0.0285419914624108, br1.betavariate(0.13, 2.23), 1.0e-6);
-        EXPECT_NEAR(0.9999442127674986, br1.betavariate(1.13, 0.23), 1.0e-6);
-        EXPECT_NEAR(0.9999871212259168, br1.betavariate(1.13, 1.00), 1.0e-6);
-        EXPECT_DOUBLE_EQ(0.5, br1.betavariate(1.13, 1.13));
-        EXPECT_NEAR(0.99664647140794072, br1.betavariate(1.13, 2.23), 1.0e-6);
-
-        // br33
-        EXPECT_NEAR(0.985732, br33.betavariate(1.00, 0.20), 1.0e-6);
-        EXPECT_DOUBLE_EQ(0.5, br33.betavariate(1.00, 1.00));
-        EXPECT_NEAR(0.208299, br33.betavariate(1.00, 2.23), 1.0e-6);
-        EXPECT_NEAR(0.024890, br33.betavariate(0.13, 0.23), 1.0e-6);
-        EXPECT_NEAR(0.975110, br33.betavariate(0.23, 0.13), 1.0e-6);
-        EXPECT_NEAR(0.500000, br33.betavariate(0.23, 0.23), 1.0e-6);
-        EXPECT_NEAR(0.014268, br33.betavariate(0.20, 1.00), 1.0e-6);
-        EXPECT_NEAR(0.000199, br33.betavariate(0.13, 2.23), 1.0e-6);
-        EXPECT_NEAR(0.980101, br33.betavariate(1.13, 0.23), 1.0e-6);
-        EXPECT_NEAR(0.592979, br33.betavariate(1.13, 1.00), 1.0e-6);
-        EXPECT_NEAR(0.500000, br33.betavariate(1.13, 1.13), 1.0e-6);
-        EXPECT_NEAR(0.277096, br33.betavariate(1.13, 2.23), 1.0e-6);
+        EXPECT_DOUBLE_EQ(0.5, br33.betavariate(1.13, 1.13));
+        EXPECT_DOUBLE_EQ(0.5, br33.betavariate(2.23, 2.23));
 
 
         EXPECT_THROW(br0.betavariate(-0.23, 0.31), AlphaBetaArgsException);
@@ -1288,86 +1406,30 @@ namespace tests_bases
             EXPECT_DOUBLE_EQ(0.0, br0.expovariate(LAMBDAS[i]));
 
         for (int i = 0; i < 5; ++i)
-            EXPECT_DOUBLE_EQ(-std::log(1.0 - double(0xffff'ffffUL) / double(1ULL << 32)) / LAMBDAS[i], br1.expovariate(LAMBDAS[i]));
+            EXPECT_DOUBLE_EQ(expo1 / LAMBDAS[i], br1.expovariate(LAMBDAS[i]));
 
         for (int i = 0; i < 5; ++i)
             EXPECT_DOUBLE_EQ(0.0, br1_0.expovariate(LAMBDAS[i]));
 
         for (int i = 0; i < 5; ++i)
-            EXPECT_DOUBLE_EQ(-std::log(1.0 - double(0x5555'5555UL) / double(1ULL << 32)) / LAMBDAS[i], br33.expovariate(LAMBDAS[i]));
+            EXPECT_DOUBLE_EQ(expo33 / LAMBDAS[i], br33.expovariate(LAMBDAS[i]));
 
         EXPECT_THROW(br0.expovariate(0.0), ExponentialZeroLambdaException);
         EXPECT_THROW(br1_0.expovariate(-0.00001), ExponentialZeroLambdaException);
 
 
         //-- tests gammavariate()
-        // Notice: hard coded values here all come from same calls in PyRandLib. See README.md
-        // br0
-        for (double alpha : {0.13, 0.23, 1.00, 1.13, 2.23})
-            for (double beta : {0.13, 0.23, 1.00, 1.13, 2.23})
-                EXPECT_DOUBLE_EQ(0.0, br0.gammavariate(alpha, beta));
-
-        // br1
-        EXPECT_NEAR(22.133994234816, br1.gammavariate(0.13, 0.13), 1.0e-7);
-        EXPECT_NEAR(39.160143646214, br1.gammavariate(0.13, 0.23), 1.0e-7);
-        EXPECT_NEAR(170.26149411397, br1.gammavariate(0.13, 1.00), 1.0e-7);
-        EXPECT_NEAR(192.39548834879, br1.gammavariate(0.13, 1.13), 1.0e-7);
-        EXPECT_NEAR(379.68313187416, br1.gammavariate(0.13, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(12.491014706411, br1.gammavariate(0.23, 0.13), 1.0e-7);
-        EXPECT_NEAR(22.099487557497, br1.gammavariate(0.23, 0.23), 1.0e-7);
-        EXPECT_NEAR(96.084728510857, br1.gammavariate(0.23, 1.00), 1.0e-7);
-        EXPECT_NEAR(108.57574321727, br1.gammavariate(0.23, 1.13), 1.0e-7);
-        EXPECT_NEAR(214.26894457921, br1.gammavariate(0.23, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(2.8834922711298, br1.gammavariate(1.00, 0.13), 1.0e-7);
-        EXPECT_NEAR(5.1015632489212, br1.gammavariate(1.00, 0.23), 1.0e-7);
-        EXPECT_NEAR(22.180709777918, br1.gammavariate(1.00, 1.00), 1.0e-7);
-        EXPECT_NEAR(25.064202049048, br1.gammavariate(1.00, 1.13), 1.0e-7);
-        EXPECT_NEAR(49.462982804758, br1.gammavariate(1.00, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(223892.05033507, br1.gammavariate(1.13, 0.13), 1.0e-7);
-        EXPECT_NEAR(396116.70443896, br1.gammavariate(1.13, 0.23), 1.0e-7);
-        EXPECT_NEAR(1722246.5410390, br1.gammavariate(1.13, 1.00), 1.0e-7);
-        EXPECT_NEAR(1946138.5913740, br1.gammavariate(1.13, 1.13), 1.0e-7);
-        EXPECT_NEAR(3840609.7865169, br1.gammavariate(1.13, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(753.35478915882, br1.gammavariate(2.23, 0.13), 1.0e-7);
-        EXPECT_NEAR(1332.8584731271, br1.gammavariate(2.23, 0.23), 1.0e-7);
-        EXPECT_NEAR(5795.0368396832, br1.gammavariate(2.23, 1.00), 1.0e-7);
-        EXPECT_NEAR(6548.3916288420, br1.gammavariate(2.23, 1.13), 1.0e-7);
-        EXPECT_NEAR(12922.932152493, br1.gammavariate(2.23, 2.23), 1.0e-7);
+        // notice: see betavariate() tests above for gamma values evaluations
+        for (double alpha : {0.13, 0.23, 1.00, 1.13, 2.23}) {
+            for (double beta : {0.13, 0.23, 1.00, 1.13, 2.23}) {
+                EXPECT_DOUBLE_EQ(gamma0(alpha) * beta, br0.gammavariate(alpha, beta));
+                EXPECT_DOUBLE_EQ(gamma33(alpha) * beta, br33.gammavariate(alpha, beta));
+            }
+        }
 
-        // br33
-        EXPECT_NEAR(3.9796516918848e-5, br33.gammavariate(0.13, 0.13), 1.0e-7);
-        EXPECT_NEAR(7.0409222241039e-5, br33.gammavariate(0.13, 0.23), 1.0e-7);
-        EXPECT_NEAR(0.0003061270532, br33.gammavariate(0.13, 1.00), 1.0e-7);
-        EXPECT_NEAR(0.0003459235701, br33.gammavariate(0.13, 1.13), 1.0e-7);
-        EXPECT_NEAR(0.0006826633287, br33.gammavariate(0.13, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(0.0015590877717, br33.gammavariate(0.23, 0.13), 1.0e-7);
-        EXPECT_NEAR(0.0027583860575, br33.gammavariate(0.23, 0.23), 1.0e-7);
-        EXPECT_NEAR(0.0119929828589, br33.gammavariate(0.23, 1.00), 1.0e-7);
-        EXPECT_NEAR(0.0135520706305, br33.gammavariate(0.23, 1.13), 1.0e-7);
-        EXPECT_NEAR(0.0267443517753, br33.gammavariate(0.23, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(0.0527104640389, br33.gammavariate(1.00, 0.13), 1.0e-7);
-        EXPECT_NEAR(0.0932569748381, br33.gammavariate(1.00, 0.23), 1.0e-7);
-        EXPECT_NEAR(0.4054651079917, br33.gammavariate(1.00, 1.00), 1.0e-7);
-        EXPECT_NEAR(0.4581755720307, br33.gammavariate(1.00, 1.13), 1.0e-7);
-        EXPECT_NEAR(0.9041871908216, br33.gammavariate(1.00, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(0.0767924941018, br33.gammavariate(1.13, 0.13), 1.0e-7);
-        EXPECT_NEAR(0.1358636434109, br33.gammavariate(1.13, 0.23), 1.0e-7);
-        EXPECT_NEAR(0.5907114930907, br33.gammavariate(1.13, 1.00), 1.0e-7);
-        EXPECT_NEAR(0.6675039871925, br33.gammavariate(1.13, 1.13), 1.0e-7);
-        EXPECT_NEAR(1.3172866295924, br33.gammavariate(1.13, 2.23), 1.0e-7);
-
-        EXPECT_NEAR(0.2003411261479, br33.gammavariate(2.23, 0.13), 1.0e-7);
-        EXPECT_NEAR(0.3544496847232, br33.gammavariate(2.23, 0.23), 1.0e-7);
-        EXPECT_NEAR(1.5410855857529, br33.gammavariate(2.23, 1.00), 1.0e-7);
-        EXPECT_NEAR(1.7414267119008, br33.gammavariate(2.23, 1.13), 1.0e-7);
-        EXPECT_NEAR(3.4366208562290, br33.gammavariate(2.23, 2.23), 1.0e-7);
+        for (double beta : {0.13, 0.23, 1.00, 1.13, 2.23})
+            EXPECT_DOUBLE_EQ(expo1 * beta, br1.gammavariate(1.00, beta));
+        EXPECT_DOUBLE_EQ(expo33 * 0.13, br33.gammavariate(1.00, 0.13));
 
 
         EXPECT_THROW(br0.gammavariate(-0.01, 1.00), AlphaBetaArgsException);
@@ -1459,6 +1521,26 @@ namespace tests_bases
         EXPECT_THROW(br33.gauss(-0.21, -0.01), GaussSigmaException);
 
 
+        //-- tests gauss_ziggurat()
+        // notice: 64 random bits as 8 bits layer index, 1 bit sign, 52 bits abscissa and 3 unused bits
+        EXPECT_EQ(0.0, br0.gauss_ziggurat());
+        EXPECT_EQ(1.0, br0.gauss_ziggurat(1.0, 2.5));
+
+        EXPECT_NEAR(-utils::ziggurat::NORMAL_R, br1.gauss_ziggurat(), 1.0e-12);  // notice: always rejected, falls back on last evaluated value
+        EXPECT_NEAR(1.0 - 2.5 * utils::ziggurat::NORMAL_R, br1.gauss_ziggurat(1.0, 2.5), 1.0e-12);
+
+        {
+            const double z{ double(0xa'aaaa'aaaa'aaaaULL) * utils::ziggurat::NORMAL_W[0x55] };
+            EXPECT_DOUBLE_EQ(z, br33.gauss_ziggurat());
+            EXPECT_DOUBLE_EQ(1.0 + 2.5 * z, br33.gauss_ziggurat(1.0, 2.5));
+            EXPECT_DOUBLE_EQ(-0.21 + 0.17 * z, br33.gauss_ziggurat(-0.21, 0.17));
+        }
+
+        EXPECT_FALSE(br33.gauss_valid());
+        EXPECT_THROW(br33.gauss_ziggurat(-0.21, 0.0), GaussSigmaException);
+        EXPECT_THROW(br33.gauss_ziggurat(-0.21, -0.01), GaussSigmaException);
+
+
         //-- tests lognormvariate()
         // Notice: hard coded values here all come from same calls in PyRandLib. See README.md
         EXPECT_EQ(br0.lognormvariate(0.0, 1.0), br0.lognormvariate());
@@ -1506,54 +1588,16 @@ namespace tests_bases
 
         for (double alpha : alphas) {
             EXPECT_EQ(1.0, br0.paretovariate(alpha));
-            EXPECT_DOUBLE_EQ(std::pow(1.0 - double(0xffff'ffffULL) / double(1ULL << 32), -1.0 / alpha), br1.paretovariate(alpha));
-            EXPECT_DOUBLE_EQ(std::pow(1.0 - double(0x5555'5555ULL) / double(1ULL << 32), -1.0 / alpha), br33.paretovariate(alpha));
+            EXPECT_DOUBLE_EQ(std::exp(expo1 / alpha), br1.paretovariate(alpha));
+            EXPECT_DOUBLE_EQ(std::exp(expo33 / alpha), br33.paretovariate(alpha));
         }
 
         for (double alpha : alphas) {
             EXPECT_EQ(1.0, br0.paretovariate(-alpha));
-            EXPECT_DOUBLE_EQ(std::pow(1.0 - double(0xffff'ffffULL) / double(1ULL << 32), -1.0 / -alpha), br1.paretovariate(-alpha));
-            EXPECT_DOUBLE_EQ(std::pow(1.0 - double(0x5555'5555ULL) / double(1ULL << 32), -1.0 / -alpha), br33.paretovariate(-alpha));
+            EXPECT_DOUBLE_EQ(std::exp(expo1 / -alpha), br1.paretovariate(-alpha));
+            EXPECT_DOUBLE_EQ(std::exp(expo33 / -alpha), br33.paretovariate(-alpha));
         }
 
-        // Notice: hard coded values here all come from same calls in PyRandLib. See README.md
-        std::vector<double> expected{
-            1.8446744073709552e+19, 6981463658331.548 , 4294967296.0      , 50859008.46224668 ,
-            2642245.949629131     , 319557.11536777776, 65536.0           , 19112.411784415082,
-            7131.5502145218525    , 3183.4240650668435, 1625.4986772154357, 565.2938310009918 ,
-            256.0                 , 84.44850628946526
-        };
-        for (auto alpha_it = alphas.cbegin(), expected_it = expected.cbegin(); alpha_it != alphas.cend(); ++alpha_it, ++expected_it)
-            EXPECT_DOUBLE_EQ(*expected_it, br1.paretovariate(*alpha_it));
-
-        expected = {
-            5.421010862427522e-20 , 1.4323643994144677e-13, 2.3283064365386963e-10, 1.9662200074984027e-08,
-            3.78465903274584e-07  , 3.1293310394578496e-06, 1.52587890625e-05     , 5.232202043780965e-05 ,
-            0.00014022196716272393, 0.00031412717236558387, 0.0006151958251439813 , 0.0017689915317654432 ,
-            0.00390625            , 0.011841535675862483
-
-        };
-        for (auto alpha_it = alphas.cbegin(), expected_it = expected.cbegin(); alpha_it != alphas.cend(); ++alpha_it, ++expected_it)
-            EXPECT_DOUBLE_EQ(*expected_it, br1.paretovariate(-*alpha_it));
-
-        expected = {
-            2.249999999476131 , 1.7170713635634731, 1.499999999825377 , 1.3831618670937746,
-            1.3103706970027502, 1.2607343232374941, 1.2247448713202995, 1.1974648710864466,
-            1.176079022469908 , 1.1588659034539632, 1.1447142425089112, 1.1228242619562039,
-            1.1066819196681128, 1.0844717711724488
-        };
-        for (auto alpha_it = alphas.cbegin(), expected_it = expected.cbegin(); alpha_it != alphas.cend(); ++alpha_it, ++expected_it)
-            EXPECT_DOUBLE_EQ(*expected_it, br33.paretovariate(*alpha_it));
-
-        expected = {
-            0.44444444454792476, 0.5823869765812643, 0.6666666667442769, 0.7229811808657985,
-            0.7631428284281156 , 0.7931885263756894, 0.8164965809752524, 0.8350975666557225,
-            0.8502830004567883 , 0.8629126088010111, 0.8735804647701982, 0.8906113217199124,
-            0.9036020036361431 , 0.9221079115031973
-        };
-        for (auto alpha_it = alphas.cbegin(), expected_it = expected.cbegin(); alpha_it != alphas.cend(); ++alpha_it, ++expected_it)
-            EXPECT_DOUBLE_EQ(*expected_it, br33.paretovariate(-*alpha_it));
-
 
         EXPECT_THROW(br1.paretovariate(0.0), ParetoArgsValueException);
 
@@ -1887,12 +1931,12 @@ namespace tests_bases
         EXPECT_EQ(0.0L, br0.uniform<long double>());
 
         u = double(0xffff'ffff) / double(1ULL << 32);
-        EXPECT_EQ(float(u), br1.uniform<float>());
+        EXPECT_EQ(float(0xff'ffff) / 16'777'216.0f, br1.uniform<float>());
         EXPECT_EQ(u, br1.uniform());
         EXPECT_EQ((long double)u, br1.uniform<long double>());
 
         u = double(0x5555'5555) / double(1ULL << 32);
-        EXPECT_EQ(float(u), br33.uniform<float>());
+        EXPECT_EQ(float(0x55'5555) / 16'777'216.0f, br33.uniform<float>());
         EXPECT_EQ(u, br33.uniform());
         EXPECT_EQ((long double)u, br33.uniform<long double>());
 
@@ -1919,6 +1963,22 @@ namespace tests_bases
         EXPECT_EQ((long double)u * -157L, br33.uniform<long double>(-157L));
 
 
+        //-- test uniform(max) with integral types - notice: unbiased integer values
+        EXPECT_EQ(0ULL, br0.uniform<std::uint64_t>(0x3'0000'0000ULL));
+        EXPECT_EQ(0, br0.uniform<int>(-101));
+        EXPECT_EQ(0U, br0.uniform<unsigned int>(0U));
+
+        EXPECT_EQ(0xffff'fffeUL, br1.uniform<std::uint32_t>(0xffff'ffffUL));
+        EXPECT_EQ(0xffff'ffff'ffff'fffeULL, br1.uniform<std::uint64_t>(0xffff'ffff'ffff'ffffULL));
+        EXPECT_EQ(-100, br1.uniform<int>(-101));
+        EXPECT_EQ(0U, br1.uniform<unsigned int>(0U));
+
+        EXPECT_EQ(0xffff'ffffULL, br33.uniform<std::uint64_t>(0x3'0000'0000ULL));
+        EXPECT_EQ(0x5555'5555ULL, br33.uniform<std::uint64_t>(0x1'0000'0000ULL));
+        EXPECT_EQ(-33, br33.uniform<int>(-101));
+        EXPECT_EQ(std::int16_t(-33), br33.uniform<std::int16_t>(std::int16_t(-101)));
+
+
         //-- test uniform(min, max)
         EXPECT_EQ(1.0, br0.uniform<double>(1.0f, 101));
         EXPECT_EQ(1, br0.uniform<int>(1, 101));
@@ -1941,6 +2001,22 @@ namespace tests_bases
         EXPECT_EQ(-157.0L + (long double)u * 296.0L, br33.uniform<long double>(-157.0L, 139.0L));
 
 
+        //-- test uniform(min, max) with integral types - notice: unbiased integer values
+        EXPECT_EQ(-157, br0.uniform<int>(-157, 139));
+        EXPECT_EQ(-157, br0.uniform<int>(139, -157));
+        EXPECT_EQ(17, br0.uniform<int>(17, 17));
+
+        EXPECT_EQ(138, br1.uniform<int>(-157, 139));
+        EXPECT_EQ(138, br1.uniform<int>(139, -157));
+        EXPECT_EQ(0x7fff'ffff'ffff'fffeLL, br1.uniform<long long>(-0x7fff'ffff'ffff'ffffLL, 0x7fff'ffff'ffff'ffffLL));
+        EXPECT_EQ(17, br1.uniform<int>(17, 17));
+
+        EXPECT_EQ(-157 + 296 / 3, br33.uniform<int>(-157, 139));
+        EXPECT_EQ(-157 + 296 / 3, br33.uniform<int>(139, -157));
+        EXPECT_EQ(std::size_t(1'000 + 333), br33.uniform<std::size_t>(std::size_t(1'000), std::size_t(2'000)));
+        EXPECT_EQ(17, br33.uniform<int>(17, 17));
+
+
         //-- tests vonmisesvariate()
         double mus[]{ 0.0, 0.8, 3.141592653 / 2, 2.6, 3.141592653 };
         double kappas[]{ 0.01, 0.5, 1.0, 1.5, 2.0, 3.0, 4.0, 5.0, 6.0, 8.0 };
@@ -2023,15 +2099,13 @@ namespace tests_bases
             for (double beta : betas)
                 EXPECT_EQ(0.0, br0.weibullvariate(alpha, beta));
 
-        u = double(0xffff'ffffULL) / double(1ULL << 32);
         for (double alpha : alphas)
             for (double beta : betas)
-                EXPECT_EQ(alpha * std::pow(-std::log(1.0 - u), 1.0 / beta), br1.weibullvariate(alpha, beta));
+                EXPECT_DOUBLE_EQ(alpha * std::pow(expo1, 1.0 / beta), br1.weibullvariate(alpha, beta));
 
-        u = double(0x5555'5555ULL) / double(1ULL << 32);
         for (double alpha : alphas)
             for (double beta : betas)
-                EXPECT_EQ(alpha * std::pow(-std::log(1.0 - u), 1.0 / beta), br33.weibullvariate(alpha, beta));
+                EXPECT_DOUBLE_EQ(alpha * std::pow(expo33, 1.0 / beta), br33.weibullvariate(alpha, beta));
 
         EXPECT_THROW(br0.weibullvariate(-1, -1), WeibullArgsValueException);
         EXPECT_THROW(br0.weibullvariate(-1, 0), WeibullArgsValueException);
@@ -26,6 +26,7 @@ SOFTWARE.
 
 
 //===========================================================================
+#include <cmath>
 #include <cstdint>
 
 #include "gtest/gtest.h"
@@ -146,6 +147,26 @@ namespace tests_cpprl
             EXPECT_STREQ("rotation bits count (-2) cannot be negative.", nr.what());
         }
 
+        //-- tests NegativeWeightException
+        {
+            NegativeWeightException nw;
+            EXPECT_STREQ("weight values cannot be negative.", nw.what());
+        }
+        {
+            NegativeWeightException nw(-0.5);
+            EXPECT_STREQ("weight values (-0.500000) cannot be negative.", nw.what());
+        }
+
+        //-- tests NonFiniteWeightException
+        {
+            NonFiniteWeightException nfw;
+            EXPECT_STREQ("weight values must be finite.", nfw.what());
+        }
+        {
+            NonFiniteWeightException nfw(INFINITY);
+            EXPECT_STREQ("weight values (inf) must be finite.", nfw.what());
+        }
+
         //-- tests NormalSigmaException
         {
             NormalSigmaException ns;
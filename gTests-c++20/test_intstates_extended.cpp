@@ -53,6 +53,7 @@ namespace tests_internal_states
         EXPECT_EQ(es1024.extended_state.size(), 1024ULL);
         for (auto esi : es1024.extended_state)
             EXPECT_EQ(esi, 0UL);
+        EXPECT_EQ(0ULL, reinterpret_cast<std::uintptr_t>(es1024.extended_state.data()) % es1024.CACHE_LINE_SIZE);
 
 
         // tests seed()
@@ -0,0 +1,114 @@
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib Google Tests.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+//===========================================================================
+#include <cstdint>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+
+#include "internalstates/lanesstate.h"
+
+
+//===========================================================================
+namespace tests_internal_states
+{
+    //-----------------------------------------------------------------------
+    TEST(TestSuiteInternalStates, TestsLanesState)
+    {
+        using LS4 = LanesState<std::uint64_t, 4, 8>;
+        using LS8 = LanesState<std::uint64_t, 8, 16>;
+        using LS5 = LanesState<std::uint32_t, 5, 3>;
+
+
+        // tests empty constructor
+        LS4 ls_4;
+        EXPECT_EQ(4ULL, ls_4.lanes.size());
+        EXPECT_EQ(8ULL, ls_4.lanes[0].size());
+        EXPECT_EQ(8UL, LS4::BUFFERED_STEPS);
+        EXPECT_EQ(64ULL, ls_4.buffer.size());
+        EXPECT_EQ(LS4::BUFFER_SIZE, ls_4.index);
+        for (const auto& words : ls_4.lanes)
+            for (const auto w : words)
+                EXPECT_EQ(0ULL, w);
+
+        LS8 ls_8;
+        EXPECT_EQ(8ULL, ls_8.lanes.size());
+        EXPECT_EQ(16ULL, ls_8.lanes[0].size());
+        EXPECT_EQ(4UL, LS8::BUFFERED_STEPS);
+        EXPECT_EQ(64ULL, ls_8.buffer.size());
+        EXPECT_EQ(LS8::BUFFER_SIZE, ls_8.index);
+
+        LS5 ls_5;
+        EXPECT_EQ(22UL, LS5::BUFFERED_STEPS);
+        EXPECT_EQ(66UL, LS5::BUFFER_SIZE);  // notice: whole steps of the lanes
+        EXPECT_EQ(LS5::BUFFER_SIZE, ls_5.index);
+
+
+        // tests inline storage
+        EXPECT_TRUE(std::is_trivially_copyable_v<LS4>);
+        EXPECT_EQ(0ULL, reinterpret_cast<std::uintptr_t>(ls_4.lanes.data()) % LS4::CACHE_LINE_SIZE);
+        EXPECT_EQ(0ULL, reinterpret_cast<std::uintptr_t>(ls_4.buffer.data()) % LS4::CACHE_LINE_SIZE);
+        EXPECT_EQ(0ULL, reinterpret_cast<std::uintptr_t>(ls_8.lanes.data()) % LS8::CACHE_LINE_SIZE);
+        EXPECT_EQ(0ULL, reinterpret_cast<std::uintptr_t>(ls_8.buffer.data()) % LS8::CACHE_LINE_SIZE);
+
+
+        // tests copy constructor and copy assignment
+        for (std::uint32_t j = 0; j < 4; ++j)
+            for (std::uint32_t l = 0; l < 8; ++l)
+                ls_4.lanes[j][l] = 0x0123'4567'89ab'cdefULL * (8 * j + l + 1);
+        ls_4.buffer[5] = 0xfedc'ba98'7654'3210ULL;
+        ls_4.index = 5;
+
+        LS4 ls0(ls_4);
+        EXPECT_EQ(ls0.lanes, ls_4.lanes);
+        EXPECT_EQ(ls0.buffer, ls_4.buffer);
+        EXPECT_EQ(ls0.index, ls_4.index);
+
+        LS4 ls1;
+        ls1 = ls_4;
+        EXPECT_EQ(ls1.lanes, ls_4.lanes);
+        EXPECT_EQ(ls1.buffer, ls_4.buffer);
+        EXPECT_EQ(ls1.index, ls_4.index);
+
+
+        // tests operator== and operator!=
+        EXPECT_EQ(ls0, ls1);
+        ls1.lanes[3][7] ^= 1;
+        EXPECT_NE(ls0, ls1);
+        EXPECT_NE(ls1, ls0);
+        ls1 = ls0;
+        ls1.buffer[63] = 1;
+        EXPECT_NE(ls0, ls1);
+        ls1 = ls0;
+        ls1.index = 6;
+        EXPECT_NE(ls0, ls1);
+        ls1 = ls0;
+        EXPECT_EQ(ls1, ls0);
+    }
+
+}
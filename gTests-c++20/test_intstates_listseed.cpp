@@ -27,6 +27,7 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <type_traits>
 
 #include "gtest/gtest.h"
 
@@ -80,6 +81,28 @@ namespace tests_internal_states
         }
 
 
+        // tests init_index and inc_index with masked indexes
+        using LSS16 = ListSeedState<utils::SplitMix32, std::uint32_t, 16>;
+        EXPECT_TRUE(LSS16::IS_POWER_OF_2_SIZE);
+        EXPECT_FALSE(LSS64::IS_POWER_OF_2_SIZE);
+        LSS16 lss_16;
+        for (int i = 0; i < 2 * 16 + 1; ++i) {
+            lss_16.init_index(i);
+            EXPECT_EQ(i % 16, lss_16.index);
+        }
+        lss_16.init_index(0);
+        for (int i = 0; i < 2 * 16 + 1; ++i) {
+            lss_16.inc_index();
+            EXPECT_EQ((i + 1) % 16, lss_16.index);
+        }
+
+
+        // tests inline storage
+        EXPECT_TRUE(std::is_trivially_copyable_v<LSS64>);
+        EXPECT_EQ(0ULL, reinterpret_cast<std::uintptr_t>(lss_64.list.data()) % LSS64::CACHE_LINE_SIZE);
+        EXPECT_EQ(0ULL, reinterpret_cast<std::uintptr_t>(lss_31.list.data()) % LSS31::CACHE_LINE_SIZE);
+
+
         // tests seed
         lss_64.seed(0xa758'f61e'0c53'2b49ULL);
         EXPECT_EQ(15ULL, lss_64.list.size());
@@ -161,6 +184,7 @@ namespace tests_internal_states
 
 
         // tests operator== and operator!=
+        lss0.inc_index();  // notice: with inline storage, moved-from states keep their content
         EXPECT_NE(lss2, lss0);
         EXPECT_NE(lss0, lss2);
         lss0 = lss2;
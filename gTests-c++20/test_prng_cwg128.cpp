@@ -27,10 +27,13 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "cwg128.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -646,6 +649,42 @@ namespace tests_prng
         }
 
 
+        //-- tests random() and uniform() with the greatest output - notice: float and double values never get rounded up to 1.0
+        {
+            Cwg128 cwg_max;  // notice: this state gets all 128 bits set for the next output
+            cwg_max._internal_state.state.a = 0;
+            cwg_max._internal_state.state.s = utils::UInt128(0xffff'ffff'ffff'ffffULL, 0xffff'ffff'ffff'ffffULL);
+            cwg_max._internal_state.state.state = 0;
+            cwg_max._internal_state.state.weyl = 0;
+
+            Cwg128 cwg(cwg_max);
+            EXPECT_EQ(utils::UInt128(0xffff'ffff'ffff'ffffULL, 0xffff'ffff'ffff'ffffULL), cwg.next());
+
+            cwg = cwg_max;
+            EXPECT_LT(cwg.random<float>(), 1.0f);
+            cwg = cwg_max;
+            EXPECT_LT(cwg.random(), 1.0);
+            cwg = cwg_max;
+            EXPECT_LT(cwg.uniform<float>(), 1.0f);
+        }
+
+
+        //-- tests that random() is the one of BaseRandom, as used by uniform()
+        {
+            Cwg128 cwg_base(cwg128);
+            Cwg128 cwg_uniform(cwg128);
+            for (int i = 0; i < 1000; ++i) {
+                const float randf{ cwg128.random<float>() };
+                EXPECT_EQ(cwg_base.Cwg128::MyBaseClass::MyBaseClass::random<float>(), randf);
+                EXPECT_EQ(cwg_uniform.uniform<float>(), randf);
+
+                const double rand{ cwg128.random() };
+                EXPECT_EQ(cwg_base.Cwg128::MyBaseClass::MyBaseClass::random(), rand);
+                EXPECT_EQ(cwg_uniform.uniform(), rand);
+            }
+        }
+
+
         //-- tests _setstate(seed_)
         // Notice: hard coded value below have been evaluated with PyRandLib
         cwg128._setstate(-1LL);
@@ -671,6 +710,25 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, cwg128._internal_state.gauss_next);
 
 
+        //-- tests uniform() with 64-bits integer ranges - notice: unbiased values evaluated on the 128-bits outputs
+        {
+            Cwg128 rand_uniform(1);
+            Cwg128 rand_next(1);
+
+            constexpr std::uint64_t RANGE{ 0xc000'0000'0000'0001ULL };
+            for (int i = 0; i < 1000; ++i) {
+                const std::uint64_t u{ rand_uniform.uniform<std::uint64_t>(RANGE) };
+                const double expected{ double(rand_next.next()) / 340282366920938463463374607431768211456.0 * double(RANGE) };
+                EXPECT_LT(u, RANGE);
+                EXPECT_NEAR(expected, double(u), 1.0e5);
+            }
+        }
+
+
+        //-- tests fill()
+        tests_fill_against_next<Cwg128>();
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         cwg128.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint32_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
@@ -27,10 +27,13 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "cwg128_64.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -474,6 +477,10 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, cwg128_64._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<Cwg128_64>();
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         cwg128_64.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint32_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
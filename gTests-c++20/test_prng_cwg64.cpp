@@ -27,10 +27,13 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "cwg64.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -446,6 +449,22 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, cwg64._internal_state.gauss_next);
 
 
+        //-- tests random() - notice: built from the 24 or 53 most significant bits of outputs
+        {
+            Cwg64 rand_float(1);
+            Cwg64 rand_next(1);
+
+            for (int i = 0; i < 1000; ++i) {
+                EXPECT_EQ(float(rand_next.next() >> 40) / 16'777'216.0f, rand_float.random<float>());
+                EXPECT_EQ(double(rand_next.next() >> 11) / 9'007'199'254'740'992.0, rand_float.random<double>());
+            }
+        }
+
+
+        //-- tests fill()
+        tests_fill_against_next<Cwg64>();
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         cwg64.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint32_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
@@ -27,10 +27,13 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "fastrand32.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -326,6 +329,29 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, frand32._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<FastRand32>();
+
+
+        //-- tests gauss_ziggurat() - notice: signs must not depend on the short-period low bits of the outputs
+        {
+            FastRand32 rand(1);
+
+            constexpr int N{ 200'000 };
+            constexpr int LAG{ 256 };
+            std::vector<double> z(N + LAG);
+            for (auto& v : z)
+                v = rand.gauss_ziggurat();
+
+            int same_signs_count{ 0 };
+            for (int i = 0; i < N; ++i)
+                if ((z[i] < 0.0) == (z[i + LAG] < 0.0))
+                    ++same_signs_count;
+            EXPECT_GT(same_signs_count, N / 2 - 1'000);  // notice: about 4.5 sigma
+            EXPECT_LT(same_signs_count, N / 2 + 1'000);
+        }
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         frand32.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint32_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
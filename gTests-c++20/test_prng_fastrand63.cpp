@@ -27,10 +27,13 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "fastrand63.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -326,6 +329,27 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, frand63._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<FastRand63>();
+
+
+        //-- tests 64-bits bounded values - notice: both halves of the range must get hit
+        {
+            FastRand63 rand(1);
+            constexpr std::uint64_t RANGE{ 1ULL << 40 };
+
+            int upper_count{ 0 };
+            for (int i = 0; i < 10'000; ++i) {
+                const std::uint64_t v{ rand.uniform<std::uint64_t>(RANGE) };
+                EXPECT_LT(v, RANGE);
+                if (v >= RANGE / 2)
+                    ++upper_count;
+            }
+            EXPECT_GT(upper_count, 4'500);
+            EXPECT_LT(upper_count, 5'500);
+        }
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         frand63.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
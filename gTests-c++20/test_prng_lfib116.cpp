@@ -28,10 +28,13 @@ SOFTWARE.
 //===========================================================================
 #include <algorithm>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "lfib116.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -548,6 +551,10 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, lfib._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<LFib116>({ 1, 2, 3, 5, 8, 13, 97, 54, 55, 56, 2 * 55 + 3, 2053 });  // notice: partial fills start and end anywhere in the internal list
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         lfib.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
@@ -28,9 +28,12 @@ SOFTWARE.
 //===========================================================================
 #include <algorithm>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "pcg128_64.h"
 #include "utils/time.h"
@@ -340,6 +343,10 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, pcg._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<Pcg128_64>();
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         pcg.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
@@ -28,10 +28,13 @@ SOFTWARE.
 //===========================================================================
 #include <algorithm>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "squares64.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -380,6 +383,63 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, sqr._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<Squares64>({ 1, 2, 3, 5, 7, 8, 9, 13, 15, 16, 17, 97, 2053 });  // notice: partial fills are not multiples of the count of lanes
+        {
+            Squares64 rand_fill(1);
+            Squares64 rand_next(1);
+
+            std::vector<Squares64::output_type> values(2053);
+            rand_fill._internal_state.state.counter = rand_next._internal_state.state.counter = 0xffff'ffff'ffff'fff9ull;  // notice: counter wraps modulo 2^64 within the next fill
+            rand_fill.fill(values);
+            for (std::size_t i = 0; i < 20; ++i)
+                EXPECT_EQ(rand_next.next(), values[i]);
+            EXPECT_EQ(std::uint64_t(values.size() - 7), rand_fill._internal_state.state.counter);
+        }
+
+
+        //-- tests discard(), at() and fill_at()
+        {
+            Squares64 rand_seek(1);
+            Squares64 rand_next(1);
+
+            rand_seek.discard(0);
+            EXPECT_EQ(rand_next._internal_state.state.counter, rand_seek._internal_state.state.counter);
+
+            for (const std::uint64_t n : { 1ull, 2ull, 3ull, 97ull, 1001ull }) {
+                rand_seek.discard(n);
+                for (std::uint64_t i = 0; i < n; ++i)
+                    rand_next.next();
+                EXPECT_EQ(rand_next._internal_state.state.counter, rand_seek._internal_state.state.counter);
+                EXPECT_EQ(rand_next.next(), rand_seek.next());
+            }
+
+            rand_seek._internal_state.state.counter = 0xffff'ffff'ffff'fffeull;
+            rand_seek.discard(5);  // notice: modulo 2^64 increment
+            EXPECT_EQ(3ull, rand_seek._internal_state.state.counter);
+
+            const Squares64::state_type state{ rand_next._internal_state.state };
+            for (std::uint64_t c = state.counter + 1; c < state.counter + 100; ++c)
+                EXPECT_EQ(rand_seek.at(c), rand_next.next());
+            EXPECT_EQ(3ull, rand_seek._internal_state.state.counter);
+
+            constexpr std::size_t N{ 4 * 65'536 + 13 };  // notice: big enough for 4 workers, but not a multiple of 4
+            std::vector<Squares64::output_type> expected(N);
+            rand_next._internal_state.state.counter = 0xffff'ffff'ffff'0000ull;
+            rand_next.fill(expected);  // notice: sequential evaluation crossing the modulo 2^64 wrap of the counter
+
+            for (const std::size_t workers_count : { 0, 1, 2, 3, 4 }) {
+                std::vector<Squares64::output_type> values(N);
+                rand_seek.fill_at(values, 0xffff'ffff'ffff'0001ull, workers_count);
+                EXPECT_EQ(expected, values);
+                EXPECT_EQ(3ull, rand_seek._internal_state.state.counter);
+            }
+
+            rand_seek.fill_at(std::span<Squares64::output_type>(), 17, 4);
+            EXPECT_EQ(3ull, rand_seek._internal_state.state.counter);
+        }
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         sqr.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
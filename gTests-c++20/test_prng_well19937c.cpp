@@ -28,10 +28,13 @@ SOFTWARE.
 //===========================================================================
 #include <algorithm>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "well19937c.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -585,6 +588,10 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, wll._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<Well19937c>({ 1, 2, 3, 5, 8, 13, 97, 623, 624, 625, 2 * 624 + 3, 2053 });  // notice: partial fills start and end anywhere in the internal list
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         wll.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
@@ -27,11 +27,15 @@ SOFTWARE.
 
 //===========================================================================
 #include <algorithm>
+#include <array>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "xoroshiro1024.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -558,6 +562,62 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, xrsr._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<Xoroshiro1024>();
+
+
+        //-- tests jump(), long_jump() and jump(polynomial)
+        {
+            Xoroshiro1024::state_type state;
+            for (std::uint32_t j = 0; j < 16; ++j)
+                state.list[j] = 0x0123'4567'89ab'cdefull * (j + 1);
+            state.index = 5;
+
+            Xoroshiro1024 xrsr_jump(state);
+            xrsr_jump.jump();  // notice: 2^512 steps
+            EXPECT_EQ(0xa051'32b3'f8f6'73f7ull, xrsr_jump._internal_state.state.list[0]);
+            EXPECT_EQ(0xdfa8'e443'd4b5'68c8ull, xrsr_jump._internal_state.state.list[7]);
+            EXPECT_EQ(0xb66d'6afa'fdd5'3338ull, xrsr_jump._internal_state.state.list[15]);
+            EXPECT_EQ(5, xrsr_jump._internal_state.state.index);
+
+            xrsr_jump.setstate(state);
+            xrsr_jump.long_jump();  // notice: 2^768 steps
+            EXPECT_EQ(0x7918'cb59'fca3'442aull, xrsr_jump._internal_state.state.list[0]);
+            EXPECT_EQ(0x1ea6'aaec'cc92'bfb0ull, xrsr_jump._internal_state.state.list[7]);
+            EXPECT_EQ(0xdf45'faab'503e'5a78ull, xrsr_jump._internal_state.state.list[15]);
+            EXPECT_EQ(5, xrsr_jump._internal_state.state.index);
+
+            xrsr_jump.setstate(state);
+            xrsr_jump.jump(Xoroshiro1024::JUMP_POLYNOMIAL);
+            xrsr_jump.jump(Xoroshiro1024::JUMP_POLYNOMIAL);
+            Xoroshiro1024 xrsr_next(state);
+            xrsr_next.jump(std::array<Xoroshiro1024::value_type, 16>{ 0, 0, 1 });  // notice: x^128, i.e. 128 steps
+            xrsr_next.jump(Xoroshiro1024::JUMP_POLYNOMIAL);
+            xrsr_next.jump(Xoroshiro1024::JUMP_POLYNOMIAL);
+            for (int i = 0; i < 128; ++i)
+                xrsr_jump.next();
+            EXPECT_EQ(xrsr_next._internal_state.state, xrsr_jump._internal_state.state);
+
+            // polynomial x^n is a jump of n steps, for n < 1024
+            for (const std::uint32_t steps : { 0u, 1u, 2u, 15u, 16u, 17u, 63u, 64u, 100u, 1023u }) {
+                Xoroshiro1024 xrsr_poly(state);
+                Xoroshiro1024 xrsr_steps(state);
+                for (int i = 0; i < 7; ++i) {  // notice: jumps start anywhere in the internal list
+                    xrsr_poly.next();
+                    xrsr_steps.next();
+                }
+
+                std::array<Xoroshiro1024::value_type, 16> polynomial{};
+                polynomial[steps / 64] = 1ull << (steps % 64);
+                xrsr_poly.jump(polynomial);
+                for (std::uint32_t i = 0; i < steps; ++i)
+                    xrsr_steps.next();
+                for (int i = 0; i < 32; ++i)  // notice: jumps keep the current index, so internal lists may be rotations of each other
+                    EXPECT_EQ(xrsr_steps.next(), xrsr_poly.next());
+            }
+        }
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         xrsr.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
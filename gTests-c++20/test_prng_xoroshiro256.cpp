@@ -27,14 +27,22 @@ SOFTWARE.
 
 //===========================================================================
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "xoroshiro256.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
+#include "utils/ziggurat.h"
 
 
 //===========================================================================
@@ -490,6 +498,315 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, xrsr._internal_state.gauss_next);
 
 
+        //-- tests gauss_ziggurat() - notice: moments and tails of the standard normal distribution
+        {
+            Xoroshiro256 rand_zig(1);
+
+            constexpr int N{ 1'000'000 };
+            double sum{ 0.0 }, sum2{ 0.0 }, sum4{ 0.0 };
+            int count_196{ 0 }, count_tail{ 0 };
+            for (int i = 0; i < N; ++i) {
+                const double z{ rand_zig.gauss_ziggurat() };
+                sum += z;
+                sum2 += z * z;
+                sum4 += z * z * z * z;
+                if (z < -1.96 || z > 1.96)
+                    ++count_196;
+                if (z < -utils::ziggurat::NORMAL_R || z > utils::ziggurat::NORMAL_R)
+                    ++count_tail;
+            }
+
+            EXPECT_NEAR(0.0, sum / N, 0.005);
+            EXPECT_NEAR(1.0, sum2 / N, 0.01);
+            EXPECT_NEAR(3.0, sum4 / N, 0.05);
+            EXPECT_NEAR(0.05, double(count_196) / N, 0.002);
+            EXPECT_NEAR(258, count_tail, 80);  // notice: 2.58e-4 is the probability of the tails beyond NORMAL_R
+        }
+
+
+        //-- tests gauss(values, mu, sigma) - notice: moments of the normal distribution, cached value of gauss() left unchanged
+        {
+            Xoroshiro256 rand_gauss(1);
+
+            std::vector<double> values(1'000'001);  // notice: odd size
+            rand_gauss.gauss(values, 1.0, 2.0);
+            double sum{ 0.0 }, sum2{ 0.0 };
+            int count_196{ 0 };
+            for (const double v : values) {
+                sum += v;
+                sum2 += (v - 1.0) * (v - 1.0);
+                if (std::abs(v - 1.0) > 2.0 * 1.96)
+                    ++count_196;
+            }
+            const double n{ double(values.size()) };
+            EXPECT_NEAR(1.0, sum / n, 0.01);
+            EXPECT_NEAR(4.0, sum2 / n, 0.02);
+            EXPECT_NEAR(0.05, double(count_196) / n, 0.002);
+
+            std::vector<float> fvalues(999'999);
+            rand_gauss.gauss(fvalues);
+            double fsum{ 0.0 }, fsum2{ 0.0 };
+            for (const float v : fvalues) {
+                EXPECT_TRUE(std::isfinite(v));
+                fsum += v;
+                fsum2 += double(v) * v;
+            }
+            EXPECT_NEAR(0.0, fsum / fvalues.size(), 0.005);
+            EXPECT_NEAR(1.0, fsum2 / fvalues.size(), 0.01);
+
+            std::vector<double> small(3);
+            EXPECT_THROW(rand_gauss.gauss(small, 0.0, 0.0), GaussSigmaException);
+            EXPECT_THROW(rand_gauss.gauss(std::span<float>(fvalues), 0.0f, -1.0f), GaussSigmaException);
+
+            rand_gauss.gauss();  // notice: a value is now cached in the internal state
+            Xoroshiro256 rand_gauss2{ rand_gauss };
+            rand_gauss.gauss(small);
+            rand_gauss.gauss(std::span<double>());
+            EXPECT_EQ(rand_gauss2.gauss(), rand_gauss.gauss());
+        }
+
+
+        //-- tests expovariate() - notice: moments and tails of the exponential distribution
+        {
+            Xoroshiro256 rand_zig(1);
+
+            constexpr int N{ 1'000'000 };
+            double sum{ 0.0 }, sum2{ 0.0 };
+            int count_1{ 0 }, count_tail{ 0 };
+            for (int i = 0; i < N; ++i) {
+                const double e{ rand_zig.expovariate() };
+                EXPECT_GE(e, 0.0);
+                sum += e;
+                sum2 += e * e;
+                if (e > 1.0)
+                    ++count_1;
+                if (e > utils::ziggurat::EXPO_R)
+                    ++count_tail;
+            }
+
+            EXPECT_NEAR(1.0, sum / N, 0.005);
+            EXPECT_NEAR(2.0, sum2 / N, 0.02);
+            EXPECT_NEAR(0.36787944117144233, double(count_1) / N, 0.002);  // i.e. exp(-1)
+            EXPECT_NEAR(454, count_tail, 100);  // notice: 4.54e-4 is the probability of the tail beyond EXPO_R
+        }
+
+
+        //-- tests gammavariate() and betavariate() - notice: moments of the gamma and beta distributions
+        {
+            Xoroshiro256 rand_gamma(1);
+
+            constexpr int N{ 200'000 };
+            for (const double alpha : { 0.3, 1.0, 2.5, 7.0 }) {
+                constexpr double BETA{ 1.5 };
+                double sum{ 0.0 }, sum2{ 0.0 };
+                for (int i = 0; i < N; ++i) {
+                    const double g{ rand_gamma.gammavariate(alpha, BETA) };
+                    EXPECT_GE(g, 0.0);
+                    sum += g;
+                    sum2 += g * g;
+                }
+                const double mean{ sum / N };
+                EXPECT_NEAR(alpha * BETA, mean, 0.02 * alpha * BETA);
+                EXPECT_NEAR(alpha * BETA * BETA, sum2 / N - mean * mean, 0.05 * alpha * BETA * BETA);
+            }
+
+            double sum{ 0.0 };
+            for (int i = 0; i < N; ++i) {
+                const double b{ rand_gamma.betavariate(2.0, 5.0) };
+                EXPECT_GE(b, 0.0);
+                EXPECT_LE(b, 1.0);
+                sum += b;
+            }
+            EXPECT_NEAR(2.0 / 7.0, sum / N, 0.002);
+        }
+
+
+        //-- tests binomialvariate() - notice: moments of the binomial distribution, with inversion and with BTRS
+        {
+            Xoroshiro256 rand_binom(1);
+
+            constexpr int N{ 200'000 };
+            for (const auto& [n, p] : { std::pair{ 1'000LL, 0.005 }, std::pair{ 100LL, 0.5 }, std::pair{ 1'000'000LL, 0.3 }, std::pair{ 50LL, 0.9 } }) {
+                double sum{ 0.0 }, sum2{ 0.0 };
+                for (int i = 0; i < N; ++i) {
+                    const long long k{ rand_binom.binomialvariate(n, p) };
+                    EXPECT_GE(k, 0LL);
+                    EXPECT_LE(k, n);
+                    sum += double(k);
+                    sum2 += double(k) * double(k);
+                }
+                const double mean{ sum / N };
+                const double variance{ n * p * (1.0 - p) };
+                EXPECT_NEAR(n * p, mean, 5.0 * std::sqrt(variance / N));
+                EXPECT_NEAR(variance, sum2 / N - mean * mean, 0.03 * variance);
+            }
+        }
+
+
+        //-- tests sample() and sample_indexes() - notice: dense and sparse shufflings get the same uniform selections
+        {
+            Xoroshiro256 rand_sample(1);
+            Xoroshiro256 rand_indexes(1);
+
+            std::vector<int> population(1'000);
+            std::iota(population.begin(), population.end(), 0);
+            std::vector<int> out;
+            std::vector<std::size_t> indexes;
+            for (const std::size_t k : { 5, 100, 1'000 }) {
+                rand_sample.sample(out, population, k);
+                rand_indexes.sample_indexes(indexes, population.size(), k);
+                ASSERT_EQ(k, out.size());
+                for (std::size_t i = 0; i < k; ++i)
+                    EXPECT_EQ(population[indexes[i]], out[i]);
+            }
+
+            constexpr int N{ 300'000 };
+            constexpr std::size_t n{ 20 };
+            for (const std::size_t k : { 1, 15 }) {  // notice: sparse then dense shuffling
+                std::vector<int> hist(n, 0);
+                for (int i = 0; i < N; ++i) {
+                    rand_indexes.sample_indexes(indexes, n, k);
+                    hist[indexes.back()]++;
+                }
+                for (const int h : hist)
+                    EXPECT_NEAR(double(N) / n, double(h), 5.0 * std::sqrt(double(N) / n));
+            }
+        }
+
+
+        //-- tests sample() with counts - notice: counts are never expanded, and elements are drawn without replacement
+        {
+            Xoroshiro256 rand_counts(1);
+
+            const std::vector<int> population{ 0, 1, 2 };
+            std::vector<int> out;
+
+            rand_counts.sample(out, population, std::vector<int>{ 5, 0, 7 }, 12);
+            EXPECT_EQ(5, std::count(out.begin(), out.end(), 0));
+            EXPECT_EQ(0, std::count(out.begin(), out.end(), 1));
+            EXPECT_EQ(7, std::count(out.begin(), out.end(), 2));
+
+            const std::vector<long long> counts{ 300'000'000, 100'000'000, 600'000'000 };
+            constexpr std::size_t K{ 1'000'000 };
+            rand_counts.sample(out, population, counts, K);
+            ASSERT_EQ(K, out.size());
+            for (int i = 0; i < 3; ++i) {
+                const double expected{ K * double(counts[i]) / 1e9 };
+                EXPECT_NEAR(expected, double(std::count(out.begin(), out.end(), i)), 5.0 * std::sqrt(expected));
+            }
+        }
+
+
+        //-- tests shuffle(seq, workers_count) - notice: deterministic for a given seed and a given count of workers
+        {
+            constexpr std::size_t N{ 1 << 20 };
+            std::vector<std::uint32_t> ref(N);
+            std::iota(ref.begin(), ref.end(), 0);
+
+            std::vector<std::uint32_t> seq1{ ref }, seq2{ ref };
+            Xoroshiro256 rand_shuffle1(1), rand_shuffle2(1);
+            rand_shuffle1.shuffle(seq1, 4);
+            rand_shuffle2.shuffle(seq2, 4);
+            EXPECT_EQ(seq1, seq2);
+            EXPECT_EQ(rand_shuffle1.next(), rand_shuffle2.next());
+
+            std::vector<std::uint32_t> sorted{ seq1 };
+            std::sort(sorted.begin(), sorted.end());
+            EXPECT_EQ(ref, sorted);
+
+            // elements of each chunk get evenly spread over the whole sequence
+            constexpr std::size_t BLOCKS{ 16 };
+            std::vector<int> hist(BLOCKS * 4, 0);
+            for (std::size_t i = 0; i < N; ++i)
+                hist[(seq1[i] / (N / 4)) * BLOCKS + i / (N / BLOCKS)]++;
+            const double expected{ double(N) / (4 * BLOCKS) };
+            for (const int h : hist)
+                EXPECT_NEAR(expected, double(h), 5.0 * std::sqrt(expected));
+
+            // a single worker, or too small sequences, get shuffled sequentially
+            seq1 = ref;
+            seq2 = ref;
+            rand_shuffle1.seed(2);
+            rand_shuffle2.seed(2);
+            rand_shuffle1.shuffle(seq1, 1);
+            rand_shuffle2.shuffle(seq2);
+            EXPECT_EQ(seq1, seq2);
+
+            std::vector<std::uint32_t> small(1'000);
+            std::iota(small.begin(), small.end(), 0);
+            std::vector<std::uint32_t> small2{ small };
+            rand_shuffle1.shuffle(small, 8);
+            rand_shuffle2.shuffle(std::span<std::uint32_t>(small2));
+            EXPECT_EQ(small, small2);
+        }
+
+
+        //-- tests fill()
+        tests_fill_against_next<Xoroshiro256>();
+
+
+        //-- tests jump(), long_jump() and jump(polynomial)
+        {
+            Xoroshiro256::state_type state;
+            for (std::uint32_t j = 0; j < 4; ++j)
+                state.list[j] = 0x0123'4567'89ab'cdefull * (j + 1);
+
+            Xoroshiro256 xrsr_jump(state);
+            xrsr_jump.jump();  // notice: 2^128 steps
+            EXPECT_EQ(0xbcf4'643b'544b'cdb4ull, xrsr_jump._internal_state.state.list[0]);
+            EXPECT_EQ(0x2f38'bca3'12c5'bda0ull, xrsr_jump._internal_state.state.list[1]);
+            EXPECT_EQ(0x4f77'9a46'de5e'95fbull, xrsr_jump._internal_state.state.list[2]);
+            EXPECT_EQ(0xc10d'8d1d'013e'1036ull, xrsr_jump._internal_state.state.list[3]);
+
+            xrsr_jump.setstate(state);
+            xrsr_jump.long_jump();  // notice: 2^192 steps
+            EXPECT_EQ(0x9a92'0f53'a47d'0b9full, xrsr_jump._internal_state.state.list[0]);
+            EXPECT_EQ(0x1c01'9ab0'76c9'e483ull, xrsr_jump._internal_state.state.list[1]);
+            EXPECT_EQ(0x94e4'e026'0364'5a54ull, xrsr_jump._internal_state.state.list[2]);
+            EXPECT_EQ(0x9f4c'11d4'36fd'5e90ull, xrsr_jump._internal_state.state.list[3]);
+
+            xrsr_jump.setstate(state);
+            xrsr_jump.jump(Xoroshiro256::JUMP_POLYNOMIAL);
+            xrsr_jump.jump(Xoroshiro256::JUMP_POLYNOMIAL);
+            Xoroshiro256 xrsr_next(state);
+            xrsr_next.jump(std::array<Xoroshiro256::value_type, 4>{ 0, 0, 1 });  // notice: x^128, i.e. 128 steps
+            xrsr_next.jump(Xoroshiro256::JUMP_POLYNOMIAL);
+            xrsr_next.jump(Xoroshiro256::JUMP_POLYNOMIAL);
+            for (int i = 0; i < 128; ++i)
+                xrsr_jump.next();
+            EXPECT_EQ(xrsr_next._internal_state.state, xrsr_jump._internal_state.state);
+
+            // polynomial x^n is a jump of n steps, for n < 256
+            for (const std::uint32_t steps : { 0u, 1u, 2u, 15u, 16u, 17u, 63u, 64u, 100u, 255u }) {
+                Xoroshiro256 xrsr_poly(state);
+                Xoroshiro256 xrsr_steps(state);
+                for (int i = 0; i < 7; ++i) {  // notice: jumps start anywhere in the internal list
+                    xrsr_poly.next();
+                    xrsr_steps.next();
+                }
+
+                std::array<Xoroshiro256::value_type, 4> polynomial{};
+                polynomial[steps / 64] = 1ull << (steps % 64);
+                xrsr_poly.jump(polynomial);
+                for (std::uint32_t i = 0; i < steps; ++i)
+                    xrsr_steps.next();
+                EXPECT_EQ(xrsr_steps._internal_state.state, xrsr_poly._internal_state.state);
+                for (int i = 0; i < 32; ++i)
+                    EXPECT_EQ(xrsr_steps.next(), xrsr_poly.next());
+            }
+
+            // notice: the index of the internal list is not used by this engine, whatever its value
+            Xoroshiro256::state_type state_index{ state };
+            state_index.index = 1;
+            Xoroshiro256 xrsr_poly(state_index);
+            Xoroshiro256 xrsr_steps(state_index);
+            xrsr_poly.jump(std::array<Xoroshiro256::value_type, 4>{ 1ull << 5 });  // notice: x^5, i.e. 5 steps
+            for (int i = 0; i < 5; ++i)
+                xrsr_steps.next();
+            EXPECT_EQ(xrsr_steps._internal_state.state.list, xrsr_poly._internal_state.state.list);
+        }
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         xrsr.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
@@ -27,11 +27,15 @@ SOFTWARE.
 
 //===========================================================================
 #include <algorithm>
+#include <array>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "xoroshiro512.h"
+#include "g_utils/fill_tests.h"
 #include "g_utils/histogram.h"
 #include "utils/time.h"
 #include "utils/uint128.h"
@@ -610,6 +614,70 @@ namespace tests_prng
         EXPECT_DOUBLE_EQ(0.0, xrsr._internal_state.gauss_next);
 
 
+        //-- tests fill()
+        tests_fill_against_next<Xoroshiro512>();
+
+
+        //-- tests jump(), long_jump() and jump(polynomial)
+        {
+            Xoroshiro512::state_type state;
+            for (std::uint32_t j = 0; j < 8; ++j)
+                state.list[j] = 0x0123'4567'89ab'cdefull * (j + 1);
+
+            Xoroshiro512 xrsr_jump(state);
+            xrsr_jump.jump();  // notice: 2^256 steps
+            EXPECT_EQ(0xcb74'7340'37c9'bef4ull, xrsr_jump._internal_state.state.list[0]);
+            EXPECT_EQ(0x4b01'9cb8'd3f7'2990ull, xrsr_jump._internal_state.state.list[3]);
+            EXPECT_EQ(0x15e0'952a'2279'e610ull, xrsr_jump._internal_state.state.list[7]);
+
+            xrsr_jump.setstate(state);
+            xrsr_jump.long_jump();  // notice: 2^384 steps
+            EXPECT_EQ(0x29b0'5af7'4992'091bull, xrsr_jump._internal_state.state.list[0]);
+            EXPECT_EQ(0x7cf6'a1ea'9cf2'edc8ull, xrsr_jump._internal_state.state.list[3]);
+            EXPECT_EQ(0x612a'aead'b554'4e1full, xrsr_jump._internal_state.state.list[7]);
+
+            xrsr_jump.setstate(state);
+            xrsr_jump.jump(Xoroshiro512::JUMP_POLYNOMIAL);
+            xrsr_jump.jump(Xoroshiro512::JUMP_POLYNOMIAL);
+            Xoroshiro512 xrsr_next(state);
+            xrsr_next.jump(std::array<Xoroshiro512::value_type, 8>{ 0, 0, 1 });  // notice: x^128, i.e. 128 steps
+            xrsr_next.jump(Xoroshiro512::JUMP_POLYNOMIAL);
+            xrsr_next.jump(Xoroshiro512::JUMP_POLYNOMIAL);
+            for (int i = 0; i < 128; ++i)
+                xrsr_jump.next();
+            EXPECT_EQ(xrsr_next._internal_state.state, xrsr_jump._internal_state.state);
+
+            // polynomial x^n is a jump of n steps, for n < 512
+            for (const std::uint32_t steps : { 0u, 1u, 2u, 15u, 16u, 17u, 63u, 64u, 100u, 511u }) {
+                Xoroshiro512 xrsr_poly(state);
+                Xoroshiro512 xrsr_steps(state);
+                for (int i = 0; i < 7; ++i) {  // notice: jumps start anywhere in the internal list
+                    xrsr_poly.next();
+                    xrsr_steps.next();
+                }
+
+                std::array<Xoroshiro512::value_type, 8> polynomial{};
+                polynomial[steps / 64] = 1ull << (steps % 64);
+                xrsr_poly.jump(polynomial);
+                for (std::uint32_t i = 0; i < steps; ++i)
+                    xrsr_steps.next();
+                EXPECT_EQ(xrsr_steps._internal_state.state, xrsr_poly._internal_state.state);
+                for (int i = 0; i < 32; ++i)
+                    EXPECT_EQ(xrsr_steps.next(), xrsr_poly.next());
+            }
+
+            // notice: the index of the internal list is not used by this engine, whatever its value
+            Xoroshiro512::state_type state_index{ state };
+            state_index.index = 1;
+            Xoroshiro512 xrsr_poly(state_index);
+            Xoroshiro512 xrsr_steps(state_index);
+            xrsr_poly.jump(std::array<Xoroshiro512::value_type, 8>{ 1ull << 5 });  // notice: x^5, i.e. 5 steps
+            for (int i = 0; i < 5; ++i)
+                xrsr_steps.next();
+            EXPECT_EQ(xrsr_steps._internal_state.state.list, xrsr_poly._internal_state.state.list);
+        }
+
+
         //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
         xrsr.seed();  // notice: tests will be done on very different seed values each time they are run
         constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
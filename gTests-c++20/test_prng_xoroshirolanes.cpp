@@ -0,0 +1,198 @@
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib Google Tests.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+//===========================================================================
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "xoroshiro256.h"
+#include "xoroshiro512.h"
+#include "xoroshirolanes.h"
+#include "g_utils/fill_tests.h"
+#include "g_utils/histogram.h"
+#include "utils/time.h"
+#include "utils/uint128.h"
+
+
+//===========================================================================
+namespace tests_prng
+{
+    //-----------------------------------------------------------------------
+    /** Tests the lanes of XoroshiroLanes<XoroshiroT, LANES> against as many jumped instances of XoroshiroT. */
+    template<typename XoroshiroT, const std::uint32_t LANES>
+    void tests_xoroshiro_lanes()
+    {
+        using LanesT = XoroshiroLanes<XoroshiroT, LANES>;
+        constexpr std::size_t SIZE{ XoroshiroT::JUMP_POLYNOMIAL.size() };
+
+
+        //-- tests empty constructor
+        LanesT xrsr_1;
+
+        EXPECT_EQ(SIZE, xrsr_1._internal_state.state.lanes.size());
+        EXPECT_EQ(LanesT::state_type::BUFFER_SIZE, xrsr_1._internal_state.state.index);
+        for (std::uint32_t l = 0; l < LANES; ++l)
+            EXPECT_TRUE(std::any_of(xrsr_1._internal_state.state.lanes.cbegin(),
+                                    xrsr_1._internal_state.state.lanes.cend(),
+                                    [l](const auto& words) { return words[l] != 0; }));
+        EXPECT_FALSE(xrsr_1._internal_state.gauss_valid);
+        EXPECT_DOUBLE_EQ(0.0, xrsr_1._internal_state.gauss_next);
+
+
+        //-- tests Valued constructor (seed) - notice: lane l+1 is lane l after a call to jump()
+        for (const unsigned long long seed_ : { 1ULL, 0xffff'ffff'ffff'fffeULL, 9ULL }) {  // notice: std::uint64_t is unsigned long on LP64 platforms
+            LanesT xrsr(seed_);
+            XoroshiroT lane_rand(seed_);
+
+            EXPECT_EQ(LanesT::state_type::BUFFER_SIZE, xrsr._internal_state.state.index);
+            for (std::uint32_t l = 0; l < LANES; ++l) {
+                for (std::size_t j = 0; j < SIZE; ++j)
+                    EXPECT_EQ(lane_rand._internal_state.state.list[j], xrsr._internal_state.state.lanes[j][l]);
+                lane_rand.jump();
+            }
+            EXPECT_FALSE(xrsr._internal_state.gauss_valid);
+            EXPECT_DOUBLE_EQ(0.0, xrsr._internal_state.gauss_next);
+        }
+
+        EXPECT_THROW(LanesT(-8.87e+18), FloatValueRange01Exception);
+        EXPECT_THROW(LanesT(1.0001), FloatValueRange01Exception);
+
+
+        //-- tests next() - notice: outputs are interleaved, lane 0 first
+        {
+            LanesT xrsr(1);
+
+            std::vector<XoroshiroT> lanes_rand;
+            XoroshiroT lane_rand(1ULL);
+            for (std::uint32_t l = 0; l < LANES; ++l) {
+                lanes_rand.push_back(lane_rand);
+                lane_rand.jump();
+            }
+
+            for (std::uint32_t k = 0; k < 3 * LanesT::state_type::BUFFERED_STEPS; ++k) {  // notice: the lanes get advanced by whole buffers
+                for (std::uint32_t l = 0; l < LANES; ++l) {
+                    EXPECT_EQ(l, xrsr._internal_state.state.index % LANES);
+                    EXPECT_EQ(lanes_rand[l].next(), xrsr.next());
+                }
+            }
+
+            for (std::uint32_t l = 0; l < LANES; ++l)
+                for (std::size_t j = 0; j < SIZE; ++j)
+                    EXPECT_EQ(lanes_rand[l]._internal_state.state.list[j], xrsr._internal_state.state.lanes[j][l]);
+        }
+
+
+        //-- tests copy constructor, copy assignment and setstate()
+        {
+            LanesT xrsr(xrsr_1);
+            EXPECT_TRUE(xrsr_1._internal_state.state == xrsr._internal_state.state);
+
+            xrsr.next();
+            EXPECT_TRUE(xrsr_1._internal_state.state != xrsr._internal_state.state);
+
+            LanesT xrsr_copy;
+            xrsr_copy = xrsr;
+            EXPECT_TRUE(xrsr_copy._internal_state.state == xrsr._internal_state.state);
+            EXPECT_EQ(xrsr.next(), xrsr_copy.next());
+
+            LanesT xrsr_state(xrsr.state());
+            for (int i = 0; i < 3 * int(LANES) + 1; ++i)
+                EXPECT_EQ(xrsr.next(), xrsr_state.next());
+        }
+
+
+        //-- tests seed(value) and _setstate(seed_)
+        {
+            LanesT xrsr(1);
+            xrsr.next();
+            xrsr.seed(1);
+            EXPECT_TRUE(LanesT(1)._internal_state.state == xrsr._internal_state.state);
+
+            xrsr._setstate(utils::UInt128(0xffff'ffff'ffff'fffe, 0xffff'ffff'ffff'fffd));
+            EXPECT_TRUE(LanesT(0xffff'ffff'ffff'fffdULL)._internal_state.state == xrsr._internal_state.state);
+        }
+
+
+        //-- tests fill() - notice: same outputs as next() whatever the content of the buffer, while lanes may be advanced differently
+        tests_fill_against_next<LanesT>({ 0, 1, 2, 3, 5, 7, 13, 16, 17, 31, 64, 65, 127, 2053 });
+
+
+        //-- tests equidistribution - notice: not more than 1 second of test, self-adaptation to platform and configuration
+        xrsr_1.seed();  // notice: tests will be done on very different seed values each time they are run
+        constexpr std::uint64_t ENTRIES_COUNT{ 6571 };  // notice: 6571 is a prime number
+        Histogram hist(ENTRIES_COUNT);
+
+        std::uint64_t n{ 0 };
+        constexpr int INTERNAL_LOOPS_COUNT{ 1'000'000 };
+
+        std::uint64_t start_ms{ utils::get_time_ms() };
+        while (n < 60) {
+            for (int i = 0; i < INTERNAL_LOOPS_COUNT; ++i)
+                hist[(Histogram::index_type)xrsr_1(ENTRIES_COUNT)]++;
+            ++n;
+            if (utils::get_time_ms() - start_ms >= 1000)
+                break;  // no evaluation during more than 1 second duration
+        }
+
+        const std::uint64_t nloops{ n * INTERNAL_LOOPS_COUNT };
+        EXPECT_TRUE(hist.is_mean_median_difference_ok(nloops));
+        EXPECT_TRUE(hist.is_stdev_ok(nloops));
+        EXPECT_TRUE(hist.is_variance_ok());
+    }
+
+
+    //-----------------------------------------------------------------------
+    TEST(TestSuitePrng, TestsXoroshiroLanes256)
+    {
+        //-- tests the first outputs of lane 0 - notice: hard coded values are the ones of Xoroshiro256(1)
+        Xoroshiro256x4 xrsr(1);
+        const std::uint64_t expected[]{ 0xb3f2af6d0fc710c5, 0x853b559647364cea, 0x92f89756082a4514, 0x642e1c7bc266a3a7, 0xb27a48e29a233673 };
+        std::vector<Xoroshiro256x4::output_type> values(4 * std::size(expected));
+        xrsr.fill(values);
+        for (std::size_t k = 0; k < std::size(expected); ++k)
+            EXPECT_EQ(expected[k], values[4 * k]);
+
+        tests_xoroshiro_lanes<Xoroshiro256, 4>();
+        tests_xoroshiro_lanes<Xoroshiro256, 8>();
+        tests_xoroshiro_lanes<Xoroshiro256, 16>();
+    }
+
+
+    //-----------------------------------------------------------------------
+    TEST(TestSuitePrng, TestsXoroshiroLanes512)
+    {
+        tests_xoroshiro_lanes<Xoroshiro512, 4>();
+        tests_xoroshiro_lanes<Xoroshiro512, 8>();
+        tests_xoroshiro_lanes<Xoroshiro512, 16>();
+    }
+
+}
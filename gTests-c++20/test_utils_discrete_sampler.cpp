@@ -0,0 +1,117 @@
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib Google Tests.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+//===========================================================================
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "exceptions.h"
+#include "utils/discrete_sampler.h"
+#include "xoroshiro256.h"
+
+
+//===========================================================================
+namespace tests_utils
+{
+    //-----------------------------------------------------------------------
+    TEST(TestSuiteUtils, TestsUtilsDiscreteSampler)
+    {
+        // checks exceptions
+        EXPECT_THROW(utils::DiscreteSampler(std::vector<double>()), ZeroLengthException);
+        EXPECT_THROW(utils::DiscreteSampler(std::vector<double>{ 0.0, 0.0, 0.0 }), ZeroValueException);
+        EXPECT_THROW(utils::DiscreteSampler(std::vector<int>{ 1, -1, 2 }), NegativeWeightException);
+        EXPECT_THROW(utils::DiscreteSampler(std::vector<double>{ 1.0, NAN, 2.0 }), NonFiniteWeightException);
+        EXPECT_THROW(utils::DiscreteSampler(std::vector<double>{ 1.0, INFINITY }), NonFiniteWeightException);
+        EXPECT_THROW(utils::DiscreteSampler(std::vector<double>{ 1e308, 1e308 }), NonFiniteWeightException);  // notice: overflowing total
+
+        Xoroshiro256 rand(0x1234'5678'9abc'def0ull);
+
+        // checks degenerated distributions
+        {
+            const utils::DiscreteSampler sampler(std::vector<int>{ 7 });
+            EXPECT_EQ(1, sampler.size());
+            for (int i = 0; i < 1'000; ++i)
+                EXPECT_EQ(0, sampler.draw(rand));
+        }
+        {
+            const utils::DiscreteSampler sampler(std::vector<double>{ 0.0, 0.0, 3.5, 0.0 });
+            EXPECT_EQ(4, sampler.size());
+            for (int i = 0; i < 1'000; ++i)
+                EXPECT_EQ(2, sampler.draw(rand));
+        }
+
+        // checks frequencies of draws
+        {
+            const std::vector<std::uint32_t> weights{ 1, 0, 2, 3, 4, 10, 5, 25 };
+            const double total{ 50.0 };
+            const utils::DiscreteSampler sampler(weights);
+            EXPECT_EQ(weights.size(), sampler.size());
+
+            constexpr int N{ 1'000'000 };
+            std::array<int, 8> hist{};
+            for (int i = 0; i < N; ++i)
+                hist[sampler.draw(rand)]++;
+
+            EXPECT_EQ(0, hist[1]);
+            for (std::size_t i = 0; i < weights.size(); ++i) {
+                const double expected{ N * weights[i] / total };
+                EXPECT_NEAR(expected, double(hist[i]), 5.0 * std::sqrt(expected) + 1.0);
+            }
+        }
+
+        // checks bulk draws
+        {
+            const std::vector<double> weights{ 0.25, 0.5, 0.125, 0.125 };
+            const utils::DiscreteSampler sampler(weights);
+
+            constexpr int N{ 1'000'000 };
+            std::vector<std::size_t> indexes(N, 4);
+            sampler.draw(rand, indexes);
+
+            std::array<int, 4> hist{};
+            for (const std::size_t index : indexes) {
+                EXPECT_LT(index, 4);
+                hist[index]++;
+            }
+            for (std::size_t i = 0; i < weights.size(); ++i) {
+                const double expected{ N * weights[i] };
+                EXPECT_NEAR(expected, double(hist[i]), 5.0 * std::sqrt(expected));
+            }
+
+            // same seed, same draws
+            Xoroshiro256 rand1(1), rand2(1);
+            std::vector<std::size_t> bulk(1'000);
+            sampler.draw(rand1, bulk);
+            for (const std::size_t index : bulk)
+                EXPECT_EQ(index, sampler.draw(rand2));
+        }
+    }
+}
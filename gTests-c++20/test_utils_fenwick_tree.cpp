@@ -0,0 +1,112 @@
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib Google Tests.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+//===========================================================================
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/fenwick_tree.h"
+#include "squares64.h"
+
+
+//===========================================================================
+namespace tests_utils
+{
+    //-----------------------------------------------------------------------
+    TEST(TestSuiteUtils, TestsUtilsFenwickTree)
+    {
+        // checks construction and prefix sums
+        {
+            const std::array<int, 13> values{ 0, 2, 1, 3, 1, 2, 0, 2, 1, 3, 2, 2, 0 };
+            utils::FenwickTree<std::uint64_t> tree(values);
+
+            EXPECT_EQ(values.size(), tree.size());
+            EXPECT_EQ(19ULL, tree.total());
+            for (std::size_t count = 0; count <= values.size(); ++count)
+                EXPECT_EQ(std::uint64_t(std::accumulate(values.begin(), values.begin() + count, 0)), tree.prefix_sum(count));
+
+            // checks find()
+            std::uint64_t value{ 0 };
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                for (int c = 0; c < values[i]; ++c)
+                    EXPECT_EQ(i, tree.find(value++));
+            }
+
+            // checks updates
+            tree.decrease(3, 3);
+            tree.increase(6, 4);
+            EXPECT_EQ(20ULL, tree.total());
+            EXPECT_EQ(3ULL, tree.prefix_sum(4));
+            EXPECT_EQ(10ULL, tree.prefix_sum(7));
+            EXPECT_EQ(2ULL, tree.find(2));
+            EXPECT_EQ(4ULL, tree.find(3));
+            EXPECT_EQ(6ULL, tree.find(6));
+            EXPECT_EQ(6ULL, tree.find(9));
+            EXPECT_EQ(7ULL, tree.find(10));
+        }
+
+        // checks random updates against a plain vector
+        {
+            Squares64 rand(1);
+
+            constexpr std::size_t N{ 1'000 };
+            std::vector<long long> values(N);
+            for (auto& v : values)
+                v = rand.uniform<long long>(100LL);
+            utils::FenwickTree<long long> tree(values);
+
+            for (int n = 0; n < 10'000; ++n) {
+                const std::size_t i{ rand.uniform<std::size_t>(N) };
+                const long long delta{ rand.uniform<long long>(50LL) };
+                if (values[i] >= delta && rand.random() < 0.5) {
+                    values[i] -= delta;
+                    tree.decrease(i, delta);
+                }
+                else {
+                    values[i] += delta;
+                    tree.increase(i, delta);
+                }
+
+                const std::size_t count{ rand.uniform<std::size_t>(N + 1) };
+                EXPECT_EQ(std::accumulate(values.begin(), values.begin() + count, 0LL), tree.prefix_sum(count));
+
+                const long long total{ std::accumulate(values.begin(), values.end(), 0LL) };
+                ASSERT_EQ(total, tree.total());
+                if (total > 0) {
+                    const long long value{ rand.uniform<long long>(total) };
+                    const std::size_t index{ tree.find(value) };
+                    EXPECT_LE(std::accumulate(values.begin(), values.begin() + index, 0LL), value);
+                    EXPECT_GT(std::accumulate(values.begin(), values.begin() + index + 1, 0LL), value);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib Google Tests.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+//===========================================================================
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/parallel_chunks.h"
+
+
+//===========================================================================
+namespace tests_utils
+{
+    //-----------------------------------------------------------------------
+    TEST(TestSuiteUtils, TestsUtilsParallelChunks)
+    {
+        constexpr std::size_t MIN_SIZE{ utils::PARALLEL_MIN_CHUNK_SIZE };
+
+        // checks parallel_workers_count()
+        EXPECT_EQ(1ULL, utils::parallel_workers_count(0, 8));
+        EXPECT_EQ(1ULL, utils::parallel_workers_count(MIN_SIZE - 1, 8));
+        EXPECT_EQ(1ULL, utils::parallel_workers_count(MIN_SIZE, 8));
+        EXPECT_EQ(1ULL, utils::parallel_workers_count(10 * MIN_SIZE, 0));
+        EXPECT_EQ(1ULL, utils::parallel_workers_count(10 * MIN_SIZE, 1));
+        EXPECT_EQ(2ULL, utils::parallel_workers_count(2 * MIN_SIZE + 1, 8));
+        EXPECT_EQ(8ULL, utils::parallel_workers_count(10 * MIN_SIZE, 8));
+
+        // checks chunk_begin(): chunks cover [0, n) and their sizes differ by 1 at most
+        for (const std::size_t n : { 0ULL, 1ULL, 7ULL, 64ULL, 1'000ULL, 1'023ULL }) {
+            for (std::size_t w_count = 1; w_count <= 16; ++w_count) {
+                EXPECT_EQ(0ULL, utils::chunk_begin(n, w_count, 0));
+                EXPECT_EQ(n, utils::chunk_begin(n, w_count, w_count));
+
+                std::size_t min_size{ n };
+                std::size_t max_size{ 0 };
+                for (std::size_t w = 0; w < w_count; ++w) {
+                    const std::size_t begin{ utils::chunk_begin(n, w_count, w) };
+                    const std::size_t end{ utils::chunk_begin(n, w_count, w + 1) };
+                    EXPECT_LE(begin, end);
+                    min_size = std::min(min_size, end - begin);
+                    max_size = std::max(max_size, end - begin);
+                }
+                EXPECT_LE(max_size - min_size, 1ULL);
+            }
+        }
+
+        // checks run_workers(): every worker runs once
+        for (std::size_t w_count = 1; w_count <= 8; ++w_count) {
+            std::vector<std::atomic<int>> runs(w_count);
+            utils::run_workers(w_count, [&runs](const std::size_t w) { runs[w]++; });
+            for (std::size_t w = 0; w < w_count; ++w)
+                EXPECT_EQ(1, runs[w].load());
+        }
+    }
+}
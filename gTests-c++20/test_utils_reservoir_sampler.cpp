@@ -0,0 +1,160 @@
+/*
+MIT License
+
+Copyright (c) 2025 Philippe Schmouker, ph.schmouker (at) gmail.com
+
+This file is part of library CppRandLib Google Tests.
+
+Permission is hereby granted,  free of charge,  to any person obtaining a copy
+of this software and associated documentation files (the "Software"),  to deal
+in the Software without restriction,  including without limitation the  rights
+to use,  copy,  modify,  merge,  publish,  distribute, sublicense, and/or sell
+copies of the Software,  and  to  permit  persons  to  whom  the  Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS",  WITHOUT WARRANTY OF ANY  KIND,  EXPRESS  OR
+IMPLIED,  INCLUDING  BUT  NOT  LIMITED  TO  THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT  SHALL  THE
+AUTHORS  OR  COPYRIGHT  HOLDERS  BE  LIABLE  FOR  ANY CLAIM,  DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,  ARISING FROM,
+OUT  OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+//===========================================================================
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "exceptions.h"
+#include "utils/reservoir_sampler.h"
+#include "xoroshiro256.h"
+
+
+//===========================================================================
+namespace tests_utils
+{
+    //-----------------------------------------------------------------------
+    TEST(TestSuiteUtils, TestsUtilsReservoirSampler)
+    {
+        Xoroshiro256 rand(0x1234'5678'9abc'def0ull);
+
+        // checks exceptions
+        EXPECT_THROW((utils::ReservoirSampler<int, Xoroshiro256>(rand, 0)), ZeroLengthException);
+
+        // checks streams shorter than the reservoir
+        {
+            utils::ReservoirSampler<int, Xoroshiro256> sampler(rand, 10);
+            EXPECT_TRUE(sampler.sample().empty());
+            sampler.push(1);
+            sampler.push_range(std::vector<int>{ 2, 3, 4 });
+            EXPECT_EQ(4ULL, sampler.count());
+            EXPECT_EQ(std::vector<int>({ 1, 2, 3, 4 }), sampler.sample());
+        }
+
+        // checks that push() and push_range() get the same samples
+        {
+            Xoroshiro256 rand1(1), rand2(1);
+            utils::ReservoirSampler<int, Xoroshiro256> sampler1(rand1, 7), sampler2(rand2, 7);
+            for (int i = 0; i < 100'000; ++i)
+                sampler1.push(i);
+            sampler2.push_range(std::views::iota(0, 50'000));
+            sampler2.push_range(std::views::iota(50'000, 100'000));
+            EXPECT_EQ(sampler1.count(), sampler2.count());
+            EXPECT_EQ(sampler1.sample(), sampler2.sample());
+            EXPECT_EQ(rand1.next(), rand2.next());
+        }
+
+        // checks very long streams - notice: skipped items are never evaluated
+        {
+            utils::ReservoirSampler<long long, Xoroshiro256> sampler(rand, 100);
+            sampler.push_range(std::views::iota(0LL, 10'000'000'000LL));
+            EXPECT_EQ(10'000'000'000ULL, sampler.count());
+            std::vector<long long> sample{ sampler.sample() };
+            std::sort(sample.begin(), sample.end());
+            EXPECT_EQ(sample.end(), std::adjacent_find(sample.begin(), sample.end()));
+            EXPECT_GT(sample.back(), 9'000'000'000LL);  // notice: probability of failure is 0.9^100, i.e. about 2.7e-5
+        }
+
+        // checks uniformity of samples
+        {
+            constexpr int N{ 100 }, K{ 10 }, TRIALS{ 20'000 };
+            std::vector<int> hist(N, 0);
+            for (int t = 0; t < TRIALS; ++t) {
+                utils::ReservoirSampler<int, Xoroshiro256> sampler(rand, K);
+                sampler.push_range(std::views::iota(0, N));
+                for (const int item : sampler.sample())
+                    hist[item]++;
+            }
+            const double expected{ double(TRIALS) * K / N };
+            for (const int h : hist)
+                EXPECT_NEAR(expected, double(h), 5.0 * std::sqrt(expected));
+        }
+    }
+
+
+    //-----------------------------------------------------------------------
+    TEST(TestSuiteUtils, TestsUtilsWeightedReservoirSampler)
+    {
+        Xoroshiro256 rand(0x1234'5678'9abc'def0ull);
+
+        // checks exceptions
+        EXPECT_THROW((utils::WeightedReservoirSampler<int, Xoroshiro256>(rand, 0)), ZeroLengthException);
+        {
+            utils::WeightedReservoirSampler<int, Xoroshiro256> sampler(rand, 3);
+            EXPECT_THROW(sampler.push(1, -0.5), NegativeWeightException);
+        }
+
+        // checks streams shorter than the reservoir, and zero weights
+        {
+            utils::WeightedReservoirSampler<int, Xoroshiro256> sampler(rand, 10);
+            sampler.push(1, 2.0);
+            sampler.push(2, 0.0);
+            sampler.push_range(std::vector<int>{ 3, 4, 5 }, std::vector<double>{ 1.0, 0.0, 0.5 });
+            EXPECT_EQ(5ULL, sampler.count());
+            std::vector<int> sample{ sampler.sample() };
+            std::sort(sample.begin(), sample.end());
+            EXPECT_EQ(std::vector<int>({ 1, 3, 5 }), sample);
+        }
+
+        // checks that items are selected according to their weights
+        {
+            constexpr int N{ 10 }, TRIALS{ 200'000 };
+            std::vector<double> weights(N);
+            for (int i = 0; i < N; ++i)
+                weights[i] = double(i + 1);
+            weights[4] = 0.0;
+            const double total_weight{ 50.0 };
+
+            std::vector<int> hist(N, 0);
+            for (int t = 0; t < TRIALS; ++t) {
+                utils::WeightedReservoirSampler<int, Xoroshiro256> sampler(rand, 1);
+                sampler.push_range(std::views::iota(0, N), weights);
+                hist[sampler.sample().front()]++;
+            }
+            EXPECT_EQ(0, hist[4]);
+            for (int i = 0; i < N; ++i) {
+                const double expected{ TRIALS * weights[i] / total_weight };
+                EXPECT_NEAR(expected, double(hist[i]), 5.0 * std::sqrt(expected) + 1.0);
+            }
+        }
+
+        // checks that the k items with the greatest weights are mostly selected
+        {
+            utils::WeightedReservoirSampler<int, Xoroshiro256> sampler(rand, 5);
+            for (int i = 0; i < 100'000; ++i)
+                sampler.push(i, i < 5 ? 1.0e12 : 1.0);
+            std::vector<int> sample{ sampler.sample() };
+            std::sort(sample.begin(), sample.end());
+            EXPECT_EQ(std::vector<int>({ 0, 1, 2, 3, 4 }), sample);
+        }
+    }
+}
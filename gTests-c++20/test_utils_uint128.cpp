@@ -27,6 +27,7 @@ SOFTWARE.
 
 //===========================================================================
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -619,5 +620,24 @@ namespace tests_utils
             EXPECT_EQ(v.lo, ~mask_lo);
         }
 
+
+        //-- tests trivially copyable representation
+        EXPECT_EQ(16ULL, sizeof(utils::UInt128));
+        EXPECT_TRUE(std::is_trivially_copyable_v<utils::UInt128>);
+
+
+        //-- tests constexpr evaluations - notice: one step of the PCG 128-bits LCG
+        {
+            constexpr utils::UInt128 a{ 0x2360'ed05'1fc6'5da4ull, 0x4385'df64'9fcc'f645ull };
+            constexpr utils::UInt128 c{ 0x5851'f42d'4c95'7f2dull, 0x1405'7b7e'f767'814full };
+            constexpr utils::UInt128 x{ 0x0123'4567'89ab'cdefull, 0xfedc'ba98'7654'3210ull };
+            constexpr utils::UInt128 y{ a * x + c };
+            static_assert(y == utils::UInt128(0xdada'ad9c'63c3'e748ull, 0x069e'5cbb'98f4'5f9full));
+            EXPECT_EQ(0xdada'ad9c'63c3'e748ull, y.hi);
+            EXPECT_EQ(0x069e'5cbb'98f4'5f9full, y.lo);
+
+            constexpr utils::UInt128 z{ (y >> 17) ^ (y << 33) };
+            static_assert(z.lo == ((0x069e'5cbb'98f4'5f9full >> 17) ^ (0xdada'ad9c'63c3'e748ull << 47) ^ (0x069e'5cbb'98f4'5f9full << 33)));
+        }
     }
 }